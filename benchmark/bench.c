@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : bench.c
+// Description : Benchmark firmware, one transfer of each direction.
+// Author      :
+// Project     : I²C-Lib Benchmark
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   bench.c
+/// \brief
+/// Firmware run by `bench_sim` in simavr.
+/// \details
+/// Built once per operation mode and MCU by the Makefile. The masters
+/// write `BENCH_BYTES` bytes to the simulated slave and read the same
+/// amount back, each in its own transaction. Every phase is framed by
+/// markers written to GPIOR0, the simulator takes the CPU cycle count
+/// of each marker.
+///
+/// The interrupt driven master submits `BENCH_TRANSACTIONS` writes and
+/// as many reads instead, each of `BENCH_BYTES`, one right after the
+/// other. With `I2C0_HW_QUEUE_SIZE` they queue up.
+///
+/// `BENCH_WRITE_READ` reads `BENCH_BYTES` from the register pointer
+/// twice instead: once by separate calls, addressing the slave for
+/// writing, sending the pointer and turning around by repeated START,
+/// once by `hardI2c0_writeRead()` doing the same in one call.
+///
+/// `BENCH_BYTE_LOOP` makes the write and the read by loops of
+/// `hardI2c0_putByteAsMaster()` and `hardI2c0_getByteAsMaster()` instead
+/// of the block functions, to compare the cycles per byte with these.
+///
+/// `BENCH_SOFT` selects the software master of `i2c_sw.c` instead of
+/// the hardware engine. `BENCH_DISPATCH` makes the same calls through
+/// the bus handles of `i2c_bus.h`, to compare with the direct calls.
+///
+/// The slave build serves the register file interface until the
+/// simulator gives up, see `bench_sim.c`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#ifdef BENCH_SOFT
+#   define I2C_BUS_WITH_SW
+#   include "i2c_sw.h"
+#else
+#   include "i2c_hw.h"
+#endif
+#ifdef BENCH_DISPATCH
+#   include "i2c_bus.h"
+#endif
+#include "bench.h"
+
+
+#ifndef BENCH_BYTES
+#   define BENCH_BYTES  16
+#endif
+
+#ifndef BENCH_TRANSACTIONS
+#   define BENCH_TRANSACTIONS   4
+#endif
+
+
+#define MARK(marker)    GPIOR0 = (marker)
+
+
+static uint8_t buffer[BENCH_BYTES];
+
+
+#if defined BENCH_DISPATCH
+
+// Same calls through the bus handles of i2c_bus.h.
+#if defined BENCH_SOFT
+#   define BENCH_BUS            I2C_BUS_SW
+#   define masterInit()         softI2c_init()
+#else
+#   define BENCH_BUS            I2C_BUS_HW0
+#   define masterInit()         hardI2c0_init(BENCH_OWN_ADDRESS, 0, I2C0_BITRATE, I2C0_PRESCALER)
+#endif
+#define masterOpen(address)     i2cBus_openDevice(BENCH_BUS, address)
+#define masterWrite(b, n)       i2cBus_writeBlock(BENCH_BUS, b, n)
+#define masterRead(b, n)        i2cBus_readBlock(BENCH_BUS, b, n)
+#define masterRelease()         i2cBus_releaseBus(BENCH_BUS)
+#define masterCheck()           i2cBus_check4Error(BENCH_BUS)
+
+#elif defined BENCH_SOFT
+
+#define masterInit()            softI2c_init()
+#define masterOpen(address)     softI2c_openDevice(address)
+#define masterWrite(b, n)       softI2c_writeBlock(b, n)
+#define masterRead(b, n)        softI2c_readBlock(b, n)
+#define masterRelease()         softI2c_releaseBus()
+#define masterCheck()           softI2c_check4Error()
+
+#elif defined I2C0_HW_AS_MASTER
+
+#define masterInit()            hardI2c0_init(BENCH_OWN_ADDRESS, 0, I2C0_BITRATE, I2C0_PRESCALER)
+#define masterOpen(address)     hardI2c0_openDevice(address)
+#if defined BENCH_BYTE_LOOP
+#   define masterWrite(b, n)    bench_put_bytes(b, n)
+#   define masterRead(b, n)     bench_get_bytes(b, n)
+#else
+#   define masterWrite(b, n)    hardI2c0_writeBlock(b, n)
+#   define masterRead(b, n)     hardI2c0_readBlock(b, n)
+#endif
+#define masterRelease()         hardI2c0_releaseBus()
+#define masterCheck()           hardI2c0_check4Error()
+
+#endif
+
+
+#if defined BENCH_BYTE_LOOP
+
+// The block transfers the way an application loops over the byte
+// primitives, with the status check per byte.
+static enum I2C_FAILURE_type bench_put_bytes(const uint8_t *data, uint16_t length)
+{
+    while (length--)
+    {
+        hardI2c0_putByteAsMaster(*data++);
+        if (hardI2c0_check4Error())
+            break;
+    }
+    return(hardI2c0_check4Error());
+}
+
+
+static enum I2C_FAILURE_type bench_get_bytes(uint8_t *data, uint16_t length)
+{
+    while (length)
+    {
+        *data++ = hardI2c0_getByteAsMaster(--length ? I2C_SEND_ACK : I2C_SEND_NO_ACK);
+        if (hardI2c0_check4Error())
+            break;
+    }
+    return(hardI2c0_check4Error());
+}
+
+#endif
+
+
+#if defined BENCH_WRITE_READ
+
+/// \brief
+/// The register pointer written and `BENCH_BYTES` read back, by separate
+/// calls and by `hardI2c0_writeRead()`.
+static void bench_write_read(void)
+{
+    static uint8_t pointer = 0;
+
+    masterInit();
+
+    MARK(BENCH_MARK_TWO_CALL_START);
+    if (!masterOpen(BENCH_SLAVE_ADDRESS))
+        if (!masterWrite(&pointer, 1))
+            if (!masterOpen(BENCH_SLAVE_ADDRESS | I2C_READ_ACCESS))
+                masterRead(buffer, BENCH_BYTES);
+    masterRelease();
+    MARK(BENCH_MARK_TWO_CALL_END);
+    if (masterCheck())
+        MARK(BENCH_MARK_FAILED);
+
+    MARK(BENCH_MARK_WRITE_READ_START);
+    hardI2c0_writeRead(BENCH_SLAVE_ADDRESS, &pointer, 1, buffer, BENCH_BYTES);
+    MARK(BENCH_MARK_WRITE_READ_END);
+    if (masterCheck())
+        MARK(BENCH_MARK_FAILED);
+}
+
+#elif defined BENCH_SOFT || defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN
+
+/// \brief
+/// One write and one read transaction of `BENCH_BYTES` each.
+/// \details
+/// The first byte written is the register pointer of the slave.
+static void bench_master(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BENCH_BYTES; i++)
+        buffer[i] = i;
+    masterInit();
+
+    MARK(BENCH_MARK_WRITE_START);
+    masterOpen(BENCH_SLAVE_ADDRESS);
+    masterWrite(buffer, BENCH_BYTES);
+    masterRelease();
+    MARK(BENCH_MARK_WRITE_END);
+    if (masterCheck())
+        MARK(BENCH_MARK_FAILED);
+
+    MARK(BENCH_MARK_READ_START);
+    masterOpen(BENCH_SLAVE_ADDRESS | I2C_READ_ACCESS);
+    masterRead(buffer, BENCH_BYTES);
+    masterRelease();
+    MARK(BENCH_MARK_READ_END);
+    if (masterCheck())
+        MARK(BENCH_MARK_FAILED);
+}
+
+#elif defined I2C0_HW_AS_MASTER
+
+/// \brief
+/// `BENCH_TRANSACTIONS` write and as many read transactions, submitted
+/// as fast as the master accepts them.
+/// \details
+/// The first byte written is the register pointer of the slave. Each
+/// read writes the register pointer first.
+static void bench_transactions(void)
+{
+    static struct I2C_STATUS_type status[BENCH_TRANSACTIONS];
+    static uint8_t pointer = 0;
+    uint8_t failure = I2C_SUCCESS;
+    uint8_t i;
+
+    for (i = 0; i < BENCH_BYTES; i++)
+        buffer[i] = i;
+    hardI2c0_init(BENCH_OWN_ADDRESS, 0, I2C0_BITRATE, I2C0_PRESCALER);
+    sei();
+
+    MARK(BENCH_MARK_WRITE_START);
+    for (i = 0; i < BENCH_TRANSACTIONS; i++)
+        while (!hardI2c0_submitTransaction(BENCH_SLAVE_ADDRESS, buffer, BENCH_BYTES, 0, 0, &status[i])) {}
+    while (hardI2c0_isBusy()) {}
+    MARK(BENCH_MARK_WRITE_END);
+    for (i = 0; i < BENCH_TRANSACTIONS; i++)
+        failure |= status[i].failure;
+
+    MARK(BENCH_MARK_READ_START);
+    for (i = 0; i < BENCH_TRANSACTIONS; i++)
+        while (!hardI2c0_submitTransaction(BENCH_SLAVE_ADDRESS, &pointer, 1, buffer, BENCH_BYTES, &status[i])) {}
+    while (hardI2c0_isBusy()) {}
+    MARK(BENCH_MARK_READ_END);
+    for (i = 0; i < BENCH_TRANSACTIONS; i++)
+        failure |= status[i].failure;
+    if (failure)
+        MARK(BENCH_MARK_FAILED);
+}
+
+#elif defined I2C0_HW_AS_SLAVE
+
+/// \brief
+/// Serve the register file, mark each transfer seen.
+static void bench_slave(void)
+{
+    uint8_t address, count;
+
+    hardI2c0_init(BENCH_OWN_ADDRESS, 0, 0, 0);
+    hardI2c0_setSlaveRegisterFile(buffer, BENCH_BYTES);
+    sei();
+    MARK(BENCH_MARK_SLAVE_READY);
+    for (;;)
+    {
+        if (hardI2c0_slaveTransferDone(&address, &count))
+            MARK((address & I2C_READ_ACCESS) ? BENCH_MARK_READ_END : BENCH_MARK_WRITE_END);
+    }
+}
+
+#endif
+
+
+int main(void)
+{
+#if defined BENCH_WRITE_READ
+    bench_write_read();
+#elif defined BENCH_SOFT || defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN
+    bench_master();
+#elif defined I2C0_HW_AS_MASTER
+    bench_transactions();
+#else
+    bench_slave();
+#endif
+    MARK(BENCH_MARK_DONE);
+    // Sleeping with interrupts disabled ends the simulation.
+    cli();
+    sleep_mode();
+    for (;;) {}
+}
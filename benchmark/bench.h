@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : bench.h
+// Description : Agreements between benchmark firmware and simulator.
+// Author      :
+// Project     : I²C-Lib Benchmark
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   bench.h
+/// \brief
+/// Bus addresses and GPIOR0 markers shared by `bench.c` and `bench_sim.c`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef BENCH_H_INCLUDED
+#define BENCH_H_INCLUDED
+
+
+/// \brief
+/// 8 bit address of the simulated slave.
+#define BENCH_SLAVE_ADDRESS     (0x50 << 1)
+
+/// \brief
+/// 8 bit address of the firmware, used by the slave builds.
+#define BENCH_OWN_ADDRESS       (0x22 << 1)
+
+
+/// \brief
+/// Values written to GPIOR0 by the firmware.
+enum BENCH_MARK_type
+{
+    BENCH_MARK_IDLE = 0,
+    BENCH_MARK_WRITE_START,
+    BENCH_MARK_WRITE_END,
+    BENCH_MARK_READ_START,
+    BENCH_MARK_READ_END,
+    BENCH_MARK_SLAVE_READY,
+    BENCH_MARK_TWO_CALL_START,
+    BENCH_MARK_TWO_CALL_END,
+    BENCH_MARK_WRITE_READ_START,
+    BENCH_MARK_WRITE_READ_END,
+    BENCH_MARK_FAILED = 0xFE,
+    BENCH_MARK_DONE = 0xFF
+};
+
+
+#endif // BENCH_H_INCLUDED
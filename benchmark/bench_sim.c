@@ -0,0 +1,577 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : bench_sim.c
+// Description : Runs a benchmark firmware in simavr, prints CSV rows.
+// Author      :
+// Project     : I²C-Lib Benchmark
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   bench_sim.c
+/// \brief
+/// Host side of the benchmark, links against libsimavr.
+/// \details
+/// Usage: `bench_sim firmware.elf mcu backend opmode bytes f_cpu`,
+/// `bench_sim --header` prints the CSV header line.
+///
+/// The firmware is run until it writes `BENCH_MARK_DONE` or the cycle
+/// limit is reached. The CPU cycle count at each GPIOR0 marker gives
+/// the duration of the write and of the read transaction. Firmware
+/// marking the phases "two_call" and "write_read" instead gets a row for
+/// each of these, both read the payload after writing the pointer byte.
+///
+/// On the TWI the cycles from each STOP to the next START within the
+/// write and the read phase are summed up as well. Firmware running
+/// several transactions per phase gets an extra row "idle" with the
+/// number of these gaps and the mean cycles per gap.
+///
+/// The CPU cycles spent in the TWI interrupt within the phases are
+/// summed up from its vector to the `reti`. The interrupt driven master
+/// gets an extra row "isr" with the number of interrupts and the mean
+/// cycles per interrupt. This is the CPU time each bus event costs, the
+/// status dispatch of `twi0_master_isr.c` included.
+///
+/// A register file slave with 256 bytes is simulated on the bus:
+///  + for the TWI it answers the bus messages of the simavr TWI core,
+///  + for the USI and the software master it is an open-drain slave on
+///    the SDA and SCL pins, answering at each edge without stretching.
+///
+/// Stock simavr neither models the USI nor the TWI slave side, so the
+/// cycles are measured for the TWI master modes and the software master
+/// only. The USI builds and the slave builds report "n/a" instead, or
+/// "timeout" if a slave build does not even get set up.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_io.h"
+#include "avr_ioport.h"
+#include "avr_twi.h"
+#include "i2c_def.h"
+#include "bench.h"
+
+
+/// \brief
+/// Where to find GPIOR0 and the bus lines of a MCU.
+struct BENCH_TARGET_type
+{
+    const char *mcu;
+    uint16_t gpior0;        ///< Data space address.
+    uint8_t twiVector;      ///< 0 without TWI.
+    char port;
+    uint8_t sdaBit;
+    uint8_t sclBit;
+};
+
+static const struct BENCH_TARGET_type targets[] =
+{
+    {"atmega168",  0x3E, 24, 'C', 4, 5},
+    {"attiny2313", 0x33,  0, 'B', 5, 7},
+};
+
+
+/// \brief
+/// The simulated register file slave.
+/// \details
+/// The first byte written sets the pointer, further bytes are stored
+/// with auto increment. Reads continue at the pointer.
+struct SIM_SLAVE_type
+{
+    uint8_t memory[256];
+    uint8_t pointer;
+    uint8_t pointerValid;
+    uint8_t selected;       ///< 8 bit address received, 0 if not addressed.
+};
+
+static struct SIM_SLAVE_type slave;
+
+
+static uint8_t slave_start(uint8_t address)
+{
+    slave.selected = ((address & ~I2C_READ_ACCESS) == BENCH_SLAVE_ADDRESS) ? address : 0;
+    slave.pointerValid = 0;
+    return(slave.selected != 0);
+}
+
+
+static uint8_t slave_write(uint8_t dataByte)
+{
+    if (!slave.selected)
+        return(0);
+    if (slave.pointerValid)
+        slave.memory[slave.pointer++] = dataByte;
+    else
+    {
+        slave.pointer = dataByte;
+        slave.pointerValid = ~0;
+    }
+    return(~0);
+}
+
+
+static uint8_t slave_read(void)
+{
+    return(slave.memory[slave.pointer++]);
+}
+
+
+// =============================================================================
+// Slave attached to the simavr TWI core.
+// =============================================================================
+
+static avr_irq_t *twiIrq;
+
+static uint64_t stopCycle;
+static uint64_t idleCycles;
+static unsigned idleGaps;
+
+static uint8_t in_phase(void);
+
+
+static void twi_hook(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+    avr_t *avr = param;
+    avr_twi_msg_irq_t msg;
+    (void)irq;
+
+    msg.u.v = value;
+    if (msg.u.twi.msg & TWI_COND_STOP)
+    {
+        slave.selected = 0;
+        stopCycle = avr->cycle;
+    }
+    if (msg.u.twi.msg & TWI_COND_START)
+    {
+        // Bus idle time between two transactions of the same phase.
+        if (stopCycle && in_phase())
+        {
+            idleCycles += avr->cycle - stopCycle;
+            idleGaps++;
+        }
+        stopCycle = 0;
+        if (slave_start(msg.u.twi.addr))
+            avr_raise_irq(twiIrq + TWI_IRQ_INPUT, avr_twi_irq_msg(TWI_COND_ACK, slave.selected, 1));
+    }
+    if (!slave.selected)
+        return;
+    if (msg.u.twi.msg & TWI_COND_WRITE)
+    {
+        slave_write(msg.u.twi.data);
+        avr_raise_irq(twiIrq + TWI_IRQ_INPUT, avr_twi_irq_msg(TWI_COND_ACK, slave.selected, 1));
+    }
+    if (msg.u.twi.msg & TWI_COND_READ)
+        avr_raise_irq(twiIrq + TWI_IRQ_INPUT, avr_twi_irq_msg(TWI_COND_READ, slave.selected, slave_read()));
+}
+
+
+static void twi_attach(avr_t *avr)
+{
+    static const char *names[2] = {"8>bench.twi.in", "32<bench.twi.out"};
+
+    twiIrq = avr_alloc_irq(&avr->irq_pool, 0, 2, names);
+    avr_connect_irq(twiIrq + TWI_IRQ_INPUT, avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_INPUT));
+    avr_connect_irq(avr_io_getirq(avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_OUTPUT), twiIrq + TWI_IRQ_OUTPUT);
+    avr_irq_register_notify(twiIrq + TWI_IRQ_OUTPUT, twi_hook, avr);
+}
+
+
+// =============================================================================
+// Slave attached to the SDA and SCL pins.
+// =============================================================================
+
+/// \brief
+/// Bit level state of the pin slave.
+enum PIN_PHASE_type
+{
+    PIN_IDLE = 0,       ///< Wait for START.
+    PIN_RECEIVE,        ///< Shift in address or data.
+    PIN_ACK_OUT,        ///< Drive ACK.
+    PIN_TRANSMIT,       ///< Shift out data.
+    PIN_ACK_IN          ///< Sample ACK of the master.
+};
+
+struct PIN_BUS_type
+{
+    avr_irq_t *sdaIrq;
+    avr_irq_t *sclIrq;
+    uint8_t sdaMask;
+    uint8_t sclMask;
+    uint8_t ddr;
+    uint8_t port;
+    uint8_t sda;            ///< Line levels.
+    uint8_t scl;
+    uint8_t slaveSdaLow;
+    enum PIN_PHASE_type phase;
+    uint8_t shift;
+    uint8_t bits;
+    uint8_t addressPending;
+    uint8_t masterAck;
+};
+
+static struct PIN_BUS_type bus;
+
+
+/// \brief
+/// Next byte to send, MSB driven at once.
+static void pin_load(void)
+{
+    bus.shift = slave_read();
+    bus.bits = 0;
+    bus.phase = PIN_TRANSMIT;
+    bus.slaveSdaLow = !(bus.shift & 0x80);
+}
+
+
+/// \brief
+/// React to a change of the line levels.
+static void pin_edge(uint8_t oldSda, uint8_t oldScl)
+{
+    if (bus.scl && oldScl)
+    {
+        if (bus.sda == oldSda)
+            return;
+        bus.slaveSdaLow = 0;
+        if (!bus.sda)
+        {
+            // START or repeated START
+            bus.phase = PIN_RECEIVE;
+            bus.shift = 0;
+            bus.bits = 0;
+            bus.addressPending = ~0;
+        }
+        else
+        {
+            bus.phase = PIN_IDLE;
+            slave.selected = 0;
+        }
+        return;
+    }
+    if (bus.scl && !oldScl)
+    {
+        if (bus.phase == PIN_RECEIVE)
+        {
+            bus.shift = (bus.shift << 1) | bus.sda;
+            bus.bits++;
+        }
+        else if (bus.phase == PIN_ACK_IN)
+            bus.masterAck = !bus.sda;
+        return;
+    }
+    if (bus.scl || !oldScl)
+        return;
+    // falling SCL
+    switch (bus.phase)
+    {
+        case PIN_RECEIVE:
+            if (bus.bits < 8)
+                break;
+            if (bus.addressPending)
+            {
+                bus.addressPending = 0;
+                bus.slaveSdaLow = slave_start(bus.shift);
+            }
+            else
+                bus.slaveSdaLow = slave_write(bus.shift);
+            bus.phase = bus.slaveSdaLow ? PIN_ACK_OUT : PIN_IDLE;
+            break;
+        case PIN_ACK_OUT:
+            bus.slaveSdaLow = 0;
+            if (slave.selected & I2C_READ_ACCESS)
+                pin_load();
+            else
+            {
+                bus.phase = PIN_RECEIVE;
+                bus.shift = 0;
+                bus.bits = 0;
+            }
+            break;
+        case PIN_TRANSMIT:
+            bus.bits++;
+            if (bus.bits < 8)
+                bus.slaveSdaLow = !(bus.shift & (0x80 >> bus.bits));
+            else
+            {
+                bus.slaveSdaLow = 0;
+                bus.phase = PIN_ACK_IN;
+            }
+            break;
+        case PIN_ACK_IN:
+            if (bus.masterAck)
+                pin_load();
+            else
+                bus.phase = PIN_IDLE;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/// \brief
+/// Resolve the open-drain lines until they settle, feed the AVR pins.
+static void pin_update(void)
+{
+    uint8_t sda, scl, oldSda, oldScl;
+
+    for (;;)
+    {
+        sda = !(((bus.ddr & ~bus.port) & bus.sdaMask) || bus.slaveSdaLow);
+        scl = !((bus.ddr & ~bus.port) & bus.sclMask);
+        if ((sda == bus.sda) && (scl == bus.scl))
+            return;
+        oldSda = bus.sda;
+        oldScl = bus.scl;
+        bus.sda = sda;
+        bus.scl = scl;
+        avr_raise_irq(bus.sdaIrq, sda);
+        avr_raise_irq(bus.sclIrq, scl);
+        pin_edge(oldSda, oldScl);
+    }
+}
+
+
+static void pin_ddr_hook(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+    (void)irq;
+    (void)param;
+    bus.ddr = value;
+    pin_update();
+}
+
+
+static void pin_port_hook(struct avr_irq_t *irq, uint32_t value, void *param)
+{
+    (void)irq;
+    (void)param;
+    bus.port = value;
+    pin_update();
+}
+
+
+static void pin_attach(avr_t *avr, const struct BENCH_TARGET_type *target)
+{
+    uint32_t ioctl = AVR_IOCTL_IOPORT_GETIRQ(target->port);
+
+    memset(&bus, 0, sizeof(bus));
+    bus.sdaMask = 1 << target->sdaBit;
+    bus.sclMask = 1 << target->sclBit;
+    bus.sdaIrq = avr_io_getirq(avr, ioctl, target->sdaBit);
+    bus.sclIrq = avr_io_getirq(avr, ioctl, target->sclBit);
+    avr_irq_register_notify(avr_io_getirq(avr, ioctl, IOPORT_IRQ_DIRECTION_ALL), pin_ddr_hook, 0);
+    avr_irq_register_notify(avr_io_getirq(avr, ioctl, IOPORT_IRQ_REG_PORT), pin_port_hook, 0);
+    // pull-up resistors
+    bus.sda = 1;
+    bus.scl = 1;
+    avr_raise_irq(bus.sdaIrq, 1);
+    avr_raise_irq(bus.sclIrq, 1);
+}
+
+
+// =============================================================================
+// Time spent in the TWI interrupt.
+// =============================================================================
+
+#define OPCODE_RETI     0x9518
+
+static uint64_t isrCycle;       ///< Entry of the interrupt running, 0 if none.
+static uint64_t isrCycles;
+static unsigned isrCount;
+
+
+/// \brief
+/// Call around each instruction, `pc` before and the AVR after it.
+static void isr_step(avr_t *avr, avr_flashaddr_t pc, avr_flashaddr_t vector)
+{
+    uint16_t opcode = avr->flash[pc] | (avr->flash[pc + 1] << 8);
+
+    if (isrCycle && (opcode == OPCODE_RETI))
+    {
+        if (in_phase())
+        {
+            isrCycles += avr->cycle - isrCycle;
+            isrCount++;
+        }
+        isrCycle = 0;
+    }
+    if (avr->pc == vector)
+        isrCycle = avr->cycle;
+}
+
+
+// =============================================================================
+// Markers and report.
+// =============================================================================
+
+static uint64_t markCycle[256];
+static uint8_t markSeen[256];
+
+
+static void marker_hook(struct avr_t *avr, avr_io_addr_t addr, uint8_t value, void *param)
+{
+    (void)param;
+    avr->data[addr] = value;
+    if (!markSeen[value])
+    {
+        markSeen[value] = ~0;
+        markCycle[value] = avr->cycle;
+    }
+}
+
+
+/// \brief
+/// A phase of the firmware framed by two markers.
+struct BENCH_PHASE_type
+{
+    const char *direction;
+    enum BENCH_MARK_type start;
+    enum BENCH_MARK_type end;
+    uint8_t extraBytes;     ///< Written ahead of the payload.
+    uint8_t addresses;      ///< Address bytes sent.
+};
+
+static const struct BENCH_PHASE_type phases[] =
+{
+    {"write",      BENCH_MARK_WRITE_START,      BENCH_MARK_WRITE_END,      0, 1},
+    {"read",       BENCH_MARK_READ_START,       BENCH_MARK_READ_END,       0, 1},
+    {"two_call",   BENCH_MARK_TWO_CALL_START,   BENCH_MARK_TWO_CALL_END,   1, 2},
+    {"write_read", BENCH_MARK_WRITE_READ_START, BENCH_MARK_WRITE_READ_END, 1, 2},
+};
+
+#define PHASES  (sizeof(phases) / sizeof(phases[0]))
+
+
+// Set between the start and the end marker of any phase.
+static uint8_t in_phase(void)
+{
+    unsigned i;
+
+    for (i = 0; i < PHASES; i++)
+        if (markSeen[phases[i].start] && !markSeen[phases[i].end])
+            return(~0);
+    return(0);
+}
+
+
+static void print_row(char **argv, const struct BENCH_PHASE_type *phase,
+                      const char *status)
+{
+    unsigned long bytes = strtoul(argv[5], 0, 0);
+    double fCpu = strtod(argv[6], 0);
+    enum BENCH_MARK_type start = phase->start;
+    enum BENCH_MARK_type end = phase->end;
+    uint64_t cycles;
+
+    printf("%s,%s,%s,%s,%lu,", argv[3], argv[2], argv[4], phase->direction, bytes);
+    if (status)
+    {
+        printf(",,,,%s\n", status);
+        return;
+    }
+    if (!markSeen[start] || !markSeen[end])
+    {
+        printf(",,,,timeout\n");
+        return;
+    }
+    cycles = markCycle[end] - markCycle[start];
+    // Address and pointer bytes included, 9 SCL periods per byte.
+    printf("%llu,%.1f,%.0f,%.0f,%s\n",
+           (unsigned long long)cycles,
+           (double)cycles / bytes,
+           9.0 * (bytes + phase->extraBytes + phase->addresses) * fCpu / cycles,
+           bytes * fCpu / cycles,
+           markSeen[BENCH_MARK_FAILED] ? "failed" : "ok");
+}
+
+
+int main(int argc, char **argv)
+{
+    const struct BENCH_TARGET_type *target = 0;
+    elf_firmware_t firmware;
+    avr_t *avr;
+    avr_flashaddr_t pc, vector = 0;
+    uint64_t limit;
+    uint8_t isSlave;
+    const char *status = 0;
+    unsigned i, first;
+    int state;
+
+    if ((argc == 2) && !strcmp(argv[1], "--header"))
+    {
+        printf("backend,mcu,opmode,direction,bytes,cycles,cycles_per_byte,scl_hz,bytes_per_s,status\n");
+        return(0);
+    }
+    if (argc != 7)
+    {
+        fprintf(stderr, "usage: %s firmware.elf mcu backend opmode bytes f_cpu\n", argv[0]);
+        return(2);
+    }
+    for (i = 0; i < sizeof(targets) / sizeof(targets[0]); i++)
+        if (!strcmp(targets[i].mcu, argv[2]))
+            target = &targets[i];
+    if (!target || elf_read_firmware(argv[1], &firmware))
+    {
+        fprintf(stderr, "%s: cannot run %s on %s\n", argv[0], argv[1], argv[2]);
+        return(2);
+    }
+    avr = avr_make_mcu_by_name(argv[2]);
+    if (!avr)
+        return(2);
+    avr_init(avr);
+    avr->frequency = strtoul(argv[6], 0, 0);
+    avr_load_firmware(avr, &firmware);
+
+    avr_register_io_write(avr, target->gpior0, marker_hook, 0);
+    if (!strcmp(argv[3], "twi"))
+    {
+        twi_attach(avr);
+        vector = target->twiVector * avr->vector_size;
+    }
+    else
+        pin_attach(avr, target);
+
+    // A quarter of a second is plenty for any transfer at 100 kHz.
+    limit = avr->frequency / 4;
+    isSlave = !strcmp(argv[4], "slave");
+    do
+    {
+        pc = avr->pc;
+        state = avr_run(avr);
+        if (vector)
+            isr_step(avr, pc, vector);
+        if (markSeen[BENCH_MARK_DONE] || (isSlave && markSeen[BENCH_MARK_SLAVE_READY]))
+            break;
+    } while ((state != cpu_Done) && (state != cpu_Crashed) && (avr->cycle < limit));
+
+    // Without a model of the USI there is nothing to measure.
+    if (!strcmp(argv[3], "usi"))
+        status = "n/a";
+    if (isSlave)
+    {
+        status = markSeen[BENCH_MARK_SLAVE_READY] ? "n/a" : "timeout";
+        print_row(argv, &phases[0], status);
+        print_row(argv, &phases[1], status);
+    }
+    else
+    {
+        // Write and read, unless the firmware marked the phases beyond.
+        for (i = 2, first = 0; i < PHASES; i++)
+            if (markSeen[phases[i].start])
+                first = 2;
+        for (i = first; i < (first ? PHASES : 2); i++)
+            print_row(argv, &phases[i], status);
+        if (idleGaps)
+            printf("%s,%s,%s,idle,%u,%llu,%.1f,,,ok\n", argv[3], argv[2], argv[4], idleGaps,
+                   (unsigned long long)idleCycles, (double)idleCycles / idleGaps);
+        if (isrCount)
+            printf("%s,%s,%s,isr,%u,%llu,%.1f,,,ok\n", argv[3], argv[2], argv[4], isrCount,
+                   (unsigned long long)isrCycles, (double)isrCycles / isrCount);
+    }
+    return(0);
+}
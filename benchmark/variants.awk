@@ -0,0 +1,73 @@
+# Joins size.csv and bench.csv of the lib variants into one table.
+#
+# The variant is the folder name of each file. Per firmware the rows
+# give the text size and the cycles per byte of each direction, one
+# column per variant in the order of the files, each but the first
+# followed by its change against the first one.
+#
+# Usage: awk -F, -f variants.awk build/plain/size.csv build/plain/bench.csv \
+#            build/inline/size.csv build/inline/bench.csv ...
+
+FNR == 1 {
+    parts = split(FILENAME, part, "/")
+    variant = part[parts - 1]
+    if (!(variant in known))
+    {
+        known[variant] = 1
+        variants[++variantCount] = variant
+    }
+    next
+}
+
+{
+    firmware = $1 "," $2 "," $3
+    if (NF == 4)
+    {
+        measure = "text"
+        result = $4
+    }
+    else if ($4 == "idle")
+    {
+        measure = "idle_cycles_per_gap"
+        result = $7
+    }
+    else if ($4 == "isr")
+    {
+        measure = "isr_cycles_per_interrupt"
+        result = $7
+    }
+    else
+    {
+        measure = $4 "_cycles_per_byte"
+        result = $7
+    }
+    row = firmware "," measure
+    if (!(row in rowKnown))
+    {
+        rowKnown[row] = 1
+        rows[++rowCount] = row
+    }
+    value[row, variant] = result
+}
+
+END {
+    header = "backend,mcu,opmode,measure," variants[1]
+    for (v = 2; v <= variantCount; v++)
+        header = header "," variants[v] "," variants[v] "_delta"
+    print header
+    for (r = 1; r <= rowCount; r++)
+    {
+        row = rows[r]
+        reference = value[row, variants[1]]
+        line = row "," reference
+        for (v = 2; v <= variantCount; v++)
+        {
+            result = value[row, variants[v]]
+            delta = ""
+            if (reference != "" && result != "")
+                delta = sprintf("%+g", result - reference)
+            line = line "," result "," delta
+        }
+        print line
+    }
+}
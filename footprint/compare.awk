@@ -0,0 +1,47 @@
+# Compares a footprint table against the one of the base revision.
+#
+# Flash (text + data) and RAM (data + bss) of each configuration must not
+# grow. The functions which grew are listed to find the cause quickly.
+# Each row of the baseline must be found again: a configuration or
+# function gone missing fails, e.g. one the lib no longer builds.
+# Configurations new since the baseline are reported, but do not fail.
+#
+# Usage: awk -F, -f compare.awk base.csv footprint.csv
+
+FNR == 1 {
+    next
+}
+
+NR == FNR {
+    flash[$1 "," $2 "," $3] = $4 + $5
+    ram[$1 "," $2 "," $3] = $5 + $6
+    next
+}
+
+{
+    key = $1 "," $2 "," $3
+    seen[key] = 1
+    if (!(key in flash)) {
+        if ($3 == "TOTAL")
+            printf "new configuration %s %s: flash %d, RAM %d\n", $1, $2, $4 + $5, $5 + $6
+        next
+    }
+    if ((($4 + $5) <= flash[key]) && (($5 + $6) <= ram[key]))
+        next
+    printf "%s %s %s: flash %d -> %d, RAM %d -> %d\n", $1, $2, $3, flash[key], $4 + $5, ram[key], $5 + $6
+    if ($3 == "TOTAL")
+        failed = 1
+}
+
+END {
+    for (key in flash) {
+        if (!(key in seen)) {
+            split(key, field, ",")
+            printf "%s %s %s: missing, was flash %d, RAM %d\n", field[1], field[2], field[3], flash[key], ram[key]
+            failed = 1
+        }
+    }
+    if (failed)
+        print "footprint grew or rows went missing since the baseline"
+    exit failed
+}
@@ -0,0 +1,26 @@
+# Turns the `avr-size` output of one configuration into CSV rows.
+#
+# Each object holds one function of the lib, so the object name is the
+# function name. Objects compiled empty in this configuration are left
+# out.
+#
+# The variables of the lib are defined in i2c0_hw_state.c, its object
+# gives the row "variables". A TOTAL row closes the configuration.
+#
+# Usage: avr-size *.o | awk -v mcu=... -v opmode=... -f size2csv.awk
+
+FNR > 1 && ($1 + $2 + $3) > 0 {
+    function_name = $6
+    sub(/^.*\//, "", function_name)
+    sub(/\.o$/, "", function_name)
+    if (function_name == "i2c0_hw_state")
+        function_name = "variables"
+    printf "%s,%s,%s,%d,%d,%d\n", mcu, opmode, function_name, $1, $2, $3
+    text += $1
+    data += $2
+    bss += $3
+}
+
+END {
+    printf "%s,%s,TOTAL,%d,%d,%d\n", mcu, opmode, text, data, bss
+}
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : bus_handles.c
+// Description : Bus handles of i2c_bus.h, constant and variable.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   bus_handles.c
+/// \brief
+/// Compile time check of the bus handles, the hardware master only.
+/// \details
+/// Built by `make bus-handles`. The constant handle `I2C_BUS_HW0` and a
+/// variable handle have to build. With `CONSTANT_HANDLE` set to a bus not
+/// configured the build has to fail. There is nothing to run.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_bus.h"
+
+
+enum I2C_FAILURE_type constant_handle(uint8_t *buffer)
+{
+    if (!i2cBus_openDevice(I2C_BUS_HW0, 0x50 | I2C_READ_ACCESS))
+        i2cBus_readBlock(I2C_BUS_HW0, buffer, 2);
+    i2cBus_releaseBus(I2C_BUS_HW0);
+    return(i2cBus_check4Error(I2C_BUS_HW0));
+}
+
+
+enum I2C_FAILURE_type variable_handle(enum I2C_BUS_type bus, uint8_t *buffer)
+{
+    if (!i2cBus_openDevice(bus, 0x50 | I2C_READ_ACCESS))
+        i2cBus_readBlock(bus, buffer, 2);
+    i2cBus_releaseBus(bus);
+    return(i2cBus_check4Error(bus));
+}
+
+
+#if defined CONSTANT_HANDLE
+enum I2C_FAILURE_type unconfigured_handle(uint8_t *buffer)
+{
+    return(i2cBus_readBlock(CONSTANT_HANDLE, buffer, 2));
+}
+#endif
@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : contention.c
+// Description : Goodput of several masters contending for one bus.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   contention.c
+/// \brief
+/// Simulates 1 to `CONTENTION_MAX_MASTERS` masters on one bus and prints
+/// the goodput of each retry policy as CSV.
+/// \details
+/// Time runs in SCL periods (bits). Each master writes `CONTENTION_BYTES`
+/// to a slave of its own, then thinks for a random time before the next
+/// transfer. Masters ready while the bus is busy start together as soon
+/// as it is free, the lowest slave address wins the arbitration. The
+/// losers then follow one of these policies:
+///  + `spin`: the former demo loop, waiting for the failure code to
+///    clear. Nothing clears it, so the master is stuck for good.
+///  + `immediate`: start again as soon as the bus is free, no bound.
+///  + `backoff`: `hardI2c0_openDeviceRetry()`, random backoff by the
+///    LFSR and the window of the lib, the transfer is dropped after
+///    `I2C0_HW_RETRY_ATTEMPTS` attempts.
+///
+/// Goodput is the payload delivered per bus time. `min_share` compares
+/// the master served least to an equal share of all transfers delivered.
+/// The latency runs from a transfer getting ready to its STOP.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#include "i2c_lib_private.h"
+#include <stdio.h>
+#include <string.h>
+
+
+#ifndef CONTENTION_MAX_MASTERS
+#   define CONTENTION_MAX_MASTERS   8
+#endif
+#ifndef CONTENTION_BYTES
+#   define CONTENTION_BYTES         4
+#endif
+#ifndef CONTENTION_BITS
+#   define CONTENTION_BITS          10000000UL
+#endif
+
+// START, address and data bytes with their ACK, STOP.
+#define TRANSFER_BITS       (1 + 9 * (1 + CONTENTION_BYTES) + 1)
+// Bus free time between STOP and START.
+#define BUS_FREE_BITS       1
+// Mean think time between two transfers of one master: 4 masters load
+// the bus fully.
+#define THINK_BITS          (3 * (TRANSFER_BITS + BUS_FREE_BITS))
+// The arbitration is lost within the address field.
+#define ARBITRATION_BITS    9
+// One backoff slot in bits.
+#define SLOT_BITS           ((I2C0_HW_BACKOFF_SLOT_us * F_I2C0_HW + 999999UL) / 1000000UL)
+
+
+enum POLICY_type
+{
+    POLICY_SPIN = 0,
+    POLICY_IMMEDIATE,
+    POLICY_BACKOFF,
+    POLICY_COUNT
+};
+
+static const char *policyName[POLICY_COUNT] = {"spin", "immediate", "backoff"};
+
+
+struct MASTER_type
+{
+    uint64_t ready;         ///< Bit time the master starts, if the bus is free.
+    uint64_t since;         ///< Bit time the transfer got ready.
+    uint8_t attempts;       ///< Attempts of the transfer so far.
+    uint8_t window;         ///< Backoff window in slots.
+    uint8_t state;          ///< Backoff LFSR.
+    uint8_t stuck;          ///< Never starts again.
+    unsigned long delivered;
+    unsigned long dropped;
+};
+
+static struct MASTER_type master[CONTENTION_MAX_MASTERS];
+static uint32_t thinkRandom;
+
+
+/// \brief
+/// Think time, uniform from 0 to 2 * `THINK_BITS`.
+static uint64_t think(void)
+{
+    thinkRandom = thinkRandom * 1103515245UL + 12345UL;
+    return((thinkRandom >> 8) % (2 * THINK_BITS + 1));
+}
+
+
+/// \brief
+/// Start the next transfer of master `m` after thinking, from bit time `now`.
+static void next_transfer(struct MASTER_type *m, uint64_t now)
+{
+    m->ready = now + think();
+    m->since = m->ready;
+    m->attempts = 0;
+    m->window = 1;
+}
+
+
+static void simulate(enum POLICY_type policy, uint8_t masters)
+{
+    uint64_t busFree = 0;
+    uint64_t start, end;
+    uint64_t latency, maxLatency = 0;
+    unsigned long delivered = 0, dropped = 0, minDelivered = ~0UL;
+    uint8_t i, winner;
+
+    memset(master, 0, sizeof(master));
+    thinkRandom = 1;
+    for (i = 0; i < masters; i++)
+    {
+        // Each master its own seed, e.g. its slave address.
+        master[i].state = 0x42 + 2 * i;
+        next_transfer(&master[i], 0);
+    }
+
+    while (busFree < CONTENTION_BITS)
+    {
+        // Next START: the bus is free and a master is ready.
+        start = ~0ULL;
+        for (i = 0; i < masters; i++)
+            if (!master[i].stuck && (master[i].ready < start))
+                start = master[i].ready;
+        if (start == ~0ULL)
+            break;
+        if (start < busFree)
+            start = busFree;
+        // Every master ready by now starts, the lowest address wins.
+        winner = masters;
+        for (i = 0; i < masters; i++)
+        {
+            if (master[i].stuck || (master[i].ready > start))
+                continue;
+            master[i].attempts++;
+            if (winner == masters)
+            {
+                winner = i;
+                continue;
+            }
+            switch (policy)
+            {
+                case POLICY_SPIN:
+                    master[i].stuck = ~0;
+                    break;
+                case POLICY_IMMEDIATE:
+                    master[i].ready = start;
+                    break;
+                case POLICY_BACKOFF:
+                    if (master[i].attempts >= I2C0_HW_RETRY_ATTEMPTS)
+                    {
+                        master[i].dropped++;
+                        next_transfer(&master[i], start + ARBITRATION_BITS);
+                        break;
+                    }
+                    master[i].state = I2C0_BACKOFF_NEXT(master[i].state);
+                    master[i].ready = start + ARBITRATION_BITS +
+                                      ((master[i].state & (master[i].window - 1)) + 1) * SLOT_BITS;
+                    if (master[i].window < I2C0_HW_BACKOFF_WINDOW)
+                        master[i].window <<= 1;
+                    break;
+                default:
+                    break;
+            }
+        }
+        end = start + TRANSFER_BITS;
+        latency = end - master[winner].since;
+        if (latency > maxLatency)
+            maxLatency = latency;
+        master[winner].delivered++;
+        busFree = end + BUS_FREE_BITS;
+        next_transfer(&master[winner], busFree);
+    }
+
+    for (i = 0; i < masters; i++)
+    {
+        delivered += master[i].delivered;
+        dropped += master[i].dropped;
+        if (master[i].delivered < minDelivered)
+            minDelivered = master[i].delivered;
+    }
+    printf("%s,%u,%.1f,%.0f,%lu,%lu,%.0f\n",
+           policyName[policy], masters,
+           100.0 * delivered * CONTENTION_BYTES * 8 / busFree,
+           delivered ? 100.0 * minDelivered * masters / delivered : 0.0,
+           delivered, dropped,
+           maxLatency * 1e6 / F_I2C0_HW);
+}
+
+
+int main(void)
+{
+    uint8_t policy, masters;
+
+    printf("policy,masters,goodput_percent,min_share_percent,delivered,dropped,max_latency_us\n");
+    for (policy = 0; policy < POLICY_COUNT; policy++)
+        for (masters = 1; masters <= CONTENTION_MAX_MASTERS; masters++)
+            simulate(policy, masters);
+    return(0);
+}
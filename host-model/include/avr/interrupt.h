@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : interrupt.h
+// Description : Host stand-in of <avr/interrupt.h>.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   interrupt.h
+/// \brief
+/// Host stand-in of `<avr/interrupt.h>`.
+/// \details
+/// An `ISR()` becomes a plain function, called by the model when TWINT
+/// is set, TWIE enabled and the I-flag of `SREG` is set.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_AVR_INTERRUPT_H_INCLUDED
+#define TWI_MODEL_AVR_INTERRUPT_H_INCLUDED
+
+
+#include <avr/io.h>
+
+
+#define ISR(vector)     void vector(void)
+#define sei()           (SREG |= 0x80)
+#define cli()           (SREG &= ~0x80)
+
+
+#endif // TWI_MODEL_AVR_INTERRUPT_H_INCLUDED
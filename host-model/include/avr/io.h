@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : io.h
+// Description : Host stand-in of <avr/io.h>, TWI registers by the model.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   io.h
+/// \brief
+/// Host stand-in of `<avr/io.h>`.
+/// \details
+/// Provides the TWI and Timer1 registers and bits of an ATmega168 (build
+/// with `-D__AVR_ATmega168__`) and its port C. The registers are backed
+/// by `twi_model.c`, port D by `parallel_model.c` for `make parallel-master` and
+/// `make sw-instances`.
+///
+/// Built with `-D__AVR_ATtiny2313__` it provides the USI registers and
+/// port B instead, for `make usi-speed`. These are plain storage, the
+/// USI is not modeled.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_AVR_IO_H_INCLUDED
+#define TWI_MODEL_AVR_IO_H_INCLUDED
+
+
+#include <inttypes.h>
+#include "twi_model.h"
+
+
+#if defined (__AVR_ATtiny2313__)
+
+static volatile uint8_t usi_model_register[6];
+
+#define USIDR   (usi_model_register[0])
+#define USISR   (usi_model_register[1])
+#define USICR   (usi_model_register[2])
+#define PORTB   (usi_model_register[3])
+#define PINB    (usi_model_register[4])
+#define DDRB    (usi_model_register[5])
+
+// USISR
+#define USISIF  7
+#define USIOIF  6
+#define USIPF   5
+#define USIDC   4
+
+// USICR
+#define USISIE  7
+#define USIOIE  6
+#define USIWM1  5
+#define USIWM0  4
+#define USICS1  3
+#define USICS0  2
+#define USICLK  1
+#define USITC   0
+
+#else
+
+#include "parallel_model.h"
+
+#define TWBR    (*twi_model_register(TWI_MODEL_TWBR))
+#define TWSR    (*twi_model_register(TWI_MODEL_TWSR))
+#define TWAR    (*twi_model_register(TWI_MODEL_TWAR))
+#define TWDR    (*twi_model_register(TWI_MODEL_TWDR))
+#define TWCR    (*twi_model_register(TWI_MODEL_TWCR))
+#define TWAMR   (*twi_model_register(TWI_MODEL_TWAMR))
+
+// TWCR
+#define TWINT   7
+#define TWEA    6
+#define TWSTA   5
+#define TWSTO   4
+#define TWWC    3
+#define TWEN    2
+#define TWIE    0
+
+// TWSR
+#define TWS7    7
+#define TWS6    6
+#define TWS5    5
+#define TWS4    4
+#define TWS3    3
+#define TWPS1   1
+#define TWPS0   0
+
+#define TCCR1A  (*twi_model_timer(TWI_MODEL_TCCR1A))
+#define TCCR1B  (*twi_model_timer(TWI_MODEL_TCCR1B))
+#define TCNT1   (*twi_model_timer(TWI_MODEL_TCNT1))
+#define OCR1B   (*twi_model_timer(TWI_MODEL_OCR1B))
+#define TIFR1   (*twi_model_timer(TWI_MODEL_TIFR1))
+
+// TIFR1
+#define OCF1B   2
+
+#define PORTC   (*twi_model_gpio(TWI_MODEL_PORTC))
+#define PINC    (*twi_model_gpio(TWI_MODEL_PINC))
+#define DDRC    (*twi_model_gpio(TWI_MODEL_DDRC))
+
+#define PORTD   (*parallel_model_gpio(PARALLEL_MODEL_PORTD))
+#define PIND    (*parallel_model_gpio(PARALLEL_MODEL_PIND))
+#define DDRD    (*parallel_model_gpio(PARALLEL_MODEL_DDRD))
+
+#define SREG    twi_model_sreg
+
+#define GPIOR0  twi_model_gpior0
+
+#define TWI_vect    twi_model_isr
+
+#endif
+
+
+#endif // TWI_MODEL_AVR_IO_H_INCLUDED
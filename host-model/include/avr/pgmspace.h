@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : pgmspace.h
+// Description : Host stand-in of <avr/pgmspace.h>.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   pgmspace.h
+/// \brief
+/// Host stand-in of `<avr/pgmspace.h>`. The host has one address space,
+/// flash tables are plain constants.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_AVR_PGMSPACE_H_INCLUDED
+#define TWI_MODEL_AVR_PGMSPACE_H_INCLUDED
+
+
+#include <inttypes.h>
+
+
+#define PROGMEM
+#define pgm_read_byte(address)  (*(const uint8_t *)(address))
+
+
+#endif // TWI_MODEL_AVR_PGMSPACE_H_INCLUDED
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : delay.h
+// Description : Host stand-in of <util/delay.h>.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   delay.h
+/// \brief
+/// Host stand-in of `<util/delay.h>`. The delays advance the CPU time
+/// of the TWI model.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_UTIL_DELAY_H_INCLUDED
+#define TWI_MODEL_UTIL_DELAY_H_INCLUDED
+
+
+#include "twi_model.h"
+
+
+#define _delay_us(us)   twi_model_delay_us(us)
+#define _delay_ms(ms)   twi_model_delay_us(1000UL * (ms))
+
+
+#endif // TWI_MODEL_UTIL_DELAY_H_INCLUDED
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : delay_basic.h
+// Description : Host stand-in of <util/delay_basic.h>.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   delay_basic.h
+/// \brief
+/// Host stand-in of `<util/delay_basic.h>`. The model does not track
+/// time, so the delay loops are void, as is the builtin cycle delay the
+/// USI master with `I2C0_HW_RUNTIME_SPEED` uses at `F_I2C0_HW`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_UTIL_DELAY_BASIC_H_INCLUDED
+#define TWI_MODEL_UTIL_DELAY_BASIC_H_INCLUDED
+
+
+#define _delay_loop_1(count)    ((void)(count))
+#define _delay_loop_2(count)    ((void)(count))
+#ifndef __builtin_avr_delay_cycles
+#   define __builtin_avr_delay_cycles(cycles)   ((void)(cycles))
+#endif
+
+
+#endif // TWI_MODEL_UTIL_DELAY_BASIC_H_INCLUDED
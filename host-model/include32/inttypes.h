@@ -0,0 +1,27 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : inttypes.h
+// Description : Freestanding stand-in of <inttypes.h> for 32 bit builds.
+// Author      : 
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   : 
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   inttypes.h
+/// \brief
+/// The host may lack the 32 bit C library, `make timeout-ticks` builds
+/// with `-m32 -ffreestanding`. The lib needs the types only.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_INTTYPES_H_INCLUDED
+#define TWI_MODEL_INTTYPES_H_INCLUDED
+
+
+#include <stdint.h>
+
+
+#endif // TWI_MODEL_INTTYPES_H_INCLUDED
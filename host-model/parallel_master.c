@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : parallel_master.c
+// Description : Runs the parallel software master against the bus model.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   parallel_master.c
+/// \brief
+/// Functional checks of `i2c_sw_parallel.c` on the host.
+/// \details
+/// Built by `make parallel-master`: four buses on port D bits 0 to 3,
+/// slaves on buses 0, 1 and 3, none on bus 2. The bytes have to arrive
+/// on their own bus through the bit planes, the 'ACK' bitmaps have to
+/// tell the buses apart. Returns 0 if all checks pass.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_sw_parallel.h"
+#include "parallel_model.h"
+#include <stdio.h>
+#include <string.h>
+
+
+#define PRESENT     0x0B
+
+
+static unsigned checks;
+static unsigned failures;
+
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        checks++;                                                           \
+        if (!(condition))                                                   \
+        {                                                                   \
+            failures++;                                                     \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);     \
+        }                                                                   \
+    } while (0)
+
+
+static void setup(void)
+{
+    parallel_model_reset(PRESENT);
+    parI2c_init();
+}
+
+
+static void test_write(void)
+{
+    // One bit pattern per bus, no two of them share a bit plane.
+    uint8_t bytes[8] = {0x5A, 0xC3, 0x0F, 0x81, 0x11, 0x22, 0x33, 0x44};
+    uint8_t bus;
+    uint32_t clocks;
+
+    setup();
+    CHECK(parI2c_check4Error() == I2C_SUCCESS);
+    clocks = parallel_model_clocks();
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == PRESENT);
+    for (bus = 0; bus < 4; bus++)
+        CHECK(parallel_model_selected(bus) == ((PRESENT & (1 << bus)) ? PARALLEL_MODEL_ADDRESS : 0));
+    CHECK(parI2c_putByte(0x20) == PRESENT);
+    CHECK(parI2c_putBytes(bytes) == PRESENT);
+    // Same byte to all, then the complement of each.
+    CHECK(parI2c_putByte(0x96) == PRESENT);
+    for (bus = 0; bus < 8; bus++)
+        bytes[bus] = ~bytes[bus];
+    CHECK(parI2c_putBytes(bytes) == PRESENT);
+    parI2c_releaseBus();
+    CHECK(parI2c_check4Error() == I2C_SUCCESS);
+    // 9 clocks per byte, the STOP adds one.
+    CHECK(parallel_model_clocks() - clocks == 5 * 9 + 1);
+    for (bus = 0; bus < 4; bus++)
+    {
+        CHECK(!parallel_model_selected(bus));
+        if (!(PRESENT & (1 << bus)))
+            continue;
+        CHECK(parallel_model_memory(bus)[0x20] == (uint8_t)~bytes[bus]);
+        CHECK(parallel_model_memory(bus)[0x21] == 0x96);
+        CHECK(parallel_model_memory(bus)[0x22] == bytes[bus]);
+    }
+}
+
+
+static void test_read(void)
+{
+    uint8_t first[8], second[8];
+    uint8_t bus;
+
+    setup();
+    for (bus = 0; bus < 4; bus++)
+    {
+        parallel_model_memory(bus)[0x40] = 0xA5 ^ (bus * 0x11);
+        parallel_model_memory(bus)[0x41] = 0x3C + bus;
+    }
+    memset(first, 0xEE, sizeof(first));
+    memset(second, 0xEE, sizeof(second));
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == PRESENT);
+    CHECK(parI2c_putByte(0x40) == PRESENT);
+    // Repeated START
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_READ_ACCESS) == PRESENT);
+    parI2c_getBytes(first, I2C_SEND_ACK);
+    parI2c_getBytes(second, I2C_SEND_NO_ACK);
+    parI2c_releaseBus();
+    CHECK(parI2c_check4Error() == I2C_SUCCESS);
+    for (bus = 0; bus < 4; bus++)
+    {
+        if (PRESENT & (1 << bus))
+        {
+            CHECK(first[bus] == (0xA5 ^ (bus * 0x11)));
+            CHECK(second[bus] == 0x3C + bus);
+        }
+        else
+        {
+            // Nobody drives SDA.
+            CHECK(first[bus] == 0xFF);
+            CHECK(second[bus] == 0xFF);
+        }
+    }
+    // Buses not in I2C_PAR_SDA_MASK are left alone.
+    for (bus = 4; bus < 8; bus++)
+        CHECK((first[bus] == 0xEE) && (second[bus] == 0xEE));
+}
+
+
+static void test_ack_bitmaps(void)
+{
+    uint8_t bytes[8] = {1, 2, 3, 4};
+
+    setup();
+    parallel_model_nack_after(1, 2);
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == PRESENT);
+    CHECK(parI2c_putByte(0x60) == PRESENT);
+    CHECK(parI2c_putBytes(bytes) == PRESENT);
+    // The slave on bus 1 refuses the byte after the pointer and one data
+    // byte, the others go on.
+    CHECK(parI2c_putBytes(bytes) == (PRESENT & ~0x02));
+    CHECK(parI2c_putByte(0x55) == (PRESENT & ~0x02));
+    parI2c_releaseBus();
+    // Missing acknowledges are a matter of the bitmaps only.
+    CHECK(parI2c_check4Error() == I2C_SUCCESS);
+    CHECK(parallel_model_memory(3)[0x61] == 4);
+    CHECK(parallel_model_memory(3)[0x62] == 0x55);
+    CHECK(parallel_model_memory(1)[0x60] == 2);
+    CHECK(parallel_model_memory(1)[0x61] == 0);
+
+    // No slave at another address.
+    CHECK(parI2c_openDevice((0x51 << 1) | I2C_WRITE_ACCESS) == 0);
+    parI2c_releaseBus();
+}
+
+
+static void test_bus_faults(void)
+{
+    setup();
+    parallel_model_hold_sda(0x08);
+    parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS);
+    parI2c_releaseBus();
+    CHECK(parI2c_check4Error() & I2C_SDA_BLOCKED);
+    parallel_model_hold_sda(0);
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == PRESENT);
+    parI2c_releaseBus();
+    CHECK(parI2c_check4Error() == I2C_SUCCESS);
+
+    parallel_model_hold_scl(1);
+    CHECK(parI2c_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == 0);
+    CHECK(parI2c_check4Error() & I2C_TIMED_OUT);
+    parallel_model_hold_scl(0);
+}
+
+
+int main(void)
+{
+    test_write();
+    test_read();
+    test_ack_bitmaps();
+    test_bus_faults();
+    printf("  %u checks, %u failed\n", checks, failures);
+    return(failures ? 1 : 0);
+}
@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : parallel_model.c
+// Description : Bit level model of four buses on port D.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   parallel_model.c
+/// \brief
+/// Port D and the slaves of the buses, see `parallel_model.h`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "parallel_model.h"
+#include "i2c_def.h"
+#include <string.h>
+
+
+#define PARALLEL_MODEL_BUSES    4
+
+
+/// \brief
+/// Bit level state of a slave.
+enum PARALLEL_MODEL_PHASE_type
+{
+    PHASE_IDLE = 0,     ///< Wait for START.
+    PHASE_RECEIVE,      ///< Shift in address or data.
+    PHASE_ACK_OUT,      ///< Drive ACK.
+    PHASE_TRANSMIT,     ///< Shift out data.
+    PHASE_ACK_IN        ///< Sample ACK of the master.
+};
+
+struct PARALLEL_MODEL_SLAVE_type
+{
+    uint8_t present;
+    uint8_t memory[256];
+    uint8_t pointer;
+    uint8_t pointerValid;
+    uint8_t selected;       ///< 8 bit address received, 0 if not addressed.
+    uint8_t nackAfter;
+    uint8_t received;       ///< Bytes after the address.
+    enum PARALLEL_MODEL_PHASE_type phase;
+    uint8_t shift;
+    uint8_t bits;
+    uint8_t addressPending;
+    uint8_t masterAck;
+    uint8_t sdaLow;
+};
+
+
+static volatile uint8_t gpioReg[PARALLEL_MODEL_GPIO_COUNT];
+static struct PARALLEL_MODEL_SLAVE_type slaves[PARALLEL_MODEL_BUSES];
+static uint8_t sda;             ///< Line levels, bit n is bus n.
+static uint8_t scl;
+static uint8_t sdaHeld;
+static uint8_t sclHeld;
+static uint32_t clocks;
+
+
+static uint8_t slave_start(struct PARALLEL_MODEL_SLAVE_type *slave, uint8_t address)
+{
+    slave->selected = ((address & ~I2C_READ_ACCESS) == PARALLEL_MODEL_ADDRESS) ? address : 0;
+    slave->pointerValid = 0;
+    slave->received = 0;
+    return(slave->selected != 0);
+}
+
+
+static uint8_t slave_write(struct PARALLEL_MODEL_SLAVE_type *slave, uint8_t dataByte)
+{
+    if (!slave->selected)
+        return(0);
+    if (slave->nackAfter && (slave->received >= slave->nackAfter))
+        return(0);
+    slave->received++;
+    if (slave->pointerValid)
+        slave->memory[slave->pointer++] = dataByte;
+    else
+    {
+        slave->pointer = dataByte;
+        slave->pointerValid = ~0;
+    }
+    return(~0);
+}
+
+
+/// \brief
+/// Next byte to send, MSB driven at once.
+static void slave_load(struct PARALLEL_MODEL_SLAVE_type *slave)
+{
+    slave->shift = slave->memory[slave->pointer++];
+    slave->bits = 0;
+    slave->phase = PHASE_TRANSMIT;
+    slave->sdaLow = !(slave->shift & 0x80);
+}
+
+
+/// \brief
+/// React to a change of the line levels of its bus.
+static void slave_edge(struct PARALLEL_MODEL_SLAVE_type *slave,
+                       uint8_t oldSda, uint8_t newSda, uint8_t oldScl, uint8_t newScl)
+{
+    if (newScl && oldScl)
+    {
+        if (newSda == oldSda)
+            return;
+        slave->sdaLow = 0;
+        if (!newSda)
+        {
+            // START or repeated START
+            slave->phase = PHASE_RECEIVE;
+            slave->shift = 0;
+            slave->bits = 0;
+            slave->addressPending = ~0;
+        }
+        else
+        {
+            slave->phase = PHASE_IDLE;
+            slave->selected = 0;
+        }
+        return;
+    }
+    if (newScl && !oldScl)
+    {
+        if (slave->phase == PHASE_RECEIVE)
+        {
+            slave->shift = (slave->shift << 1) | (newSda ? 1 : 0);
+            slave->bits++;
+        }
+        else if (slave->phase == PHASE_ACK_IN)
+            slave->masterAck = !newSda;
+        return;
+    }
+    if (newScl || !oldScl)
+        return;
+    // falling SCL
+    switch (slave->phase)
+    {
+        case PHASE_RECEIVE:
+            if (slave->bits < 8)
+                break;
+            if (slave->addressPending)
+            {
+                slave->addressPending = 0;
+                slave->sdaLow = slave_start(slave, slave->shift);
+            }
+            else
+                slave->sdaLow = slave_write(slave, slave->shift);
+            slave->phase = slave->sdaLow ? PHASE_ACK_OUT : PHASE_IDLE;
+            break;
+        case PHASE_ACK_OUT:
+            slave->sdaLow = 0;
+            if (slave->selected & I2C_READ_ACCESS)
+                slave_load(slave);
+            else
+            {
+                slave->phase = PHASE_RECEIVE;
+                slave->shift = 0;
+                slave->bits = 0;
+            }
+            break;
+        case PHASE_TRANSMIT:
+            slave->bits++;
+            if (slave->bits < 8)
+                slave->sdaLow = !(slave->shift & (0x80 >> slave->bits));
+            else
+            {
+                slave->sdaLow = 0;
+                slave->phase = PHASE_ACK_IN;
+            }
+            break;
+        case PHASE_ACK_IN:
+            if (slave->masterAck)
+                slave_load(slave);
+            else
+                slave->phase = PHASE_IDLE;
+            break;
+        default:
+            break;
+    }
+}
+
+
+/// \brief
+/// Resolve the open drain lines until they settle, feed the readback.
+static void gpio_sync(void)
+{
+    uint8_t pulled, newSda, newScl, oldSda, oldScl, bus;
+
+    for (;;)
+    {
+        pulled = gpioReg[PARALLEL_MODEL_DDRD] & ~gpioReg[PARALLEL_MODEL_PORTD];
+        newSda = ~(pulled | sdaHeld) & PARALLEL_MODEL_SDA_MASK;
+        for (bus = 0; bus < PARALLEL_MODEL_BUSES; bus++)
+            if (slaves[bus].present && slaves[bus].sdaLow)
+                newSda &= ~(1 << bus);
+        newScl = !((pulled & PARALLEL_MODEL_SCL_BITPOS) || sclHeld);
+        if ((newSda == sda) && (newScl == scl))
+            break;
+        oldSda = sda;
+        oldScl = scl;
+        sda = newSda;
+        scl = newScl;
+        if (scl && !oldScl)
+            clocks++;
+        for (bus = 0; bus < PARALLEL_MODEL_BUSES; bus++)
+            if (slaves[bus].present)
+                slave_edge(&slaves[bus], (oldSda >> bus) & 1, (sda >> bus) & 1, oldScl, scl);
+    }
+    // Port bits not on a bus read back high.
+    gpioReg[PARALLEL_MODEL_PIND] = (uint8_t)~(PARALLEL_MODEL_SDA_MASK | PARALLEL_MODEL_SCL_BITPOS) |
+                                   sda | (scl ? PARALLEL_MODEL_SCL_BITPOS : 0);
+}
+
+
+volatile uint8_t *parallel_model_gpio(uint8_t index)
+{
+    gpio_sync();
+    return(&gpioReg[index]);
+}
+
+
+void parallel_model_reset(uint8_t present)
+{
+    uint8_t bus;
+
+    memset((void *)gpioReg, 0, sizeof(gpioReg));
+    memset(slaves, 0, sizeof(slaves));
+    for (bus = 0; bus < PARALLEL_MODEL_BUSES; bus++)
+        slaves[bus].present = (present >> bus) & 1;
+    sda = PARALLEL_MODEL_SDA_MASK;
+    scl = 1;
+    sdaHeld = 0;
+    sclHeld = 0;
+    clocks = 0;
+    gpio_sync();
+}
+
+
+uint8_t *parallel_model_memory(uint8_t bus)
+{
+    return(slaves[bus].memory);
+}
+
+
+void parallel_model_nack_after(uint8_t bus, uint8_t bytes)
+{
+    slaves[bus].nackAfter = bytes;
+}
+
+
+void parallel_model_hold_sda(uint8_t buses)
+{
+    sdaHeld = buses;
+    gpio_sync();
+}
+
+
+void parallel_model_hold_scl(uint8_t hold)
+{
+    sclHeld = hold;
+    gpio_sync();
+}
+
+
+uint8_t parallel_model_selected(uint8_t bus)
+{
+    gpio_sync();
+    return(slaves[bus].selected);
+}
+
+
+uint32_t parallel_model_clocks(void)
+{
+    return(clocks);
+}
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : parallel_model.h
+// Description : Bit level model of four buses on port D.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   parallel_model.h
+/// \brief
+/// Bit level model of port D with up to 4 buses, lets `i2c_sw_parallel.c`
+/// and instances of `i2c_sw.c` run on the host.
+/// \details
+/// The port registers are backed by the model. Every access to one of
+/// them first synchronizes the model: the open drain lines are resolved
+/// from the data direction and port bits written since the last access
+/// and from the slaves, then each slave reacts to the edges, like a
+/// slave sampling the pins.
+///
+/// The SDA lines are port bits 0 to 3, one bus per bit, the common SCL
+/// is port bit 4. A master driving one SDA line only leaves the other
+/// buses idle, their slaves just see SCL toggle. Each bus can have a
+/// register file slave at `PARALLEL_MODEL_ADDRESS`, all of them at the
+/// same address: the first byte written sets the pointer, further bytes
+/// are stored with auto increment, reads continue at the pointer. The
+/// slaves answer at each edge without stretching the clock. A slave can
+/// be set to refuse bytes, SDA and SCL can be held low.
+///
+/// Bus timing is not modeled, the SCL clocks are counted instead.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PARALLEL_MODEL_H_INCLUDED
+#define PARALLEL_MODEL_H_INCLUDED
+
+
+#include <inttypes.h>
+
+
+/// \brief
+/// 8 bit address of the slave on each bus.
+#define PARALLEL_MODEL_ADDRESS  (0x50 << 1)
+
+
+/// \brief
+/// Port D bits of the SDA lines and of SCL.
+#define PARALLEL_MODEL_SDA_MASK     0x0F
+#define PARALLEL_MODEL_SCL_BITPOS   (1 << 4)
+
+
+/// \brief
+/// Index of the port D registers backed by the model.
+enum PARALLEL_MODEL_GPIO_type
+{
+    PARALLEL_MODEL_PORTD = 0,
+    PARALLEL_MODEL_PIND,
+    PARALLEL_MODEL_DDRD,
+    PARALLEL_MODEL_GPIO_COUNT
+};
+
+
+/// \brief
+/// The bit timing of the lib is counted in CPU cycles by this builtin of
+/// avr-gcc, on the host the time just passes.
+#define __builtin_avr_delay_cycles(cycles)  ((void)(cycles))
+
+
+volatile uint8_t *parallel_model_gpio(uint8_t index);
+
+/// \brief
+/// Lines released, slaves attached to the buses set in `present`.
+void parallel_model_reset(uint8_t present);
+
+/// \brief
+/// Register file of the slave on `bus`.
+uint8_t *parallel_model_memory(uint8_t bus);
+
+/// \brief
+/// The slave on `bus` sends 'NACK' to any byte after `bytes` bytes
+/// following the address, 0 for never.
+void parallel_model_nack_after(uint8_t bus, uint8_t bytes);
+
+/// \brief
+/// Hold SDA low on the buses set in `buses`, 0 releases all.
+void parallel_model_hold_sda(uint8_t buses);
+
+/// \brief
+/// Hold SCL low if `hold` is set.
+void parallel_model_hold_scl(uint8_t hold);
+
+/// \brief
+/// Address the slave on `bus` is selected by, 0 if not addressed.
+uint8_t parallel_model_selected(uint8_t bus);
+
+/// \brief
+/// SCL clocks since reset.
+uint32_t parallel_model_clocks(void);
+
+
+#endif // PARALLEL_MODEL_H_INCLUDED
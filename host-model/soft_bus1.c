@@ -0,0 +1,30 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : soft_bus1.c
+// Description : Instance 1 of the software master, SDA on port D bit 0.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   soft_bus1.c
+/// \brief
+/// `softI2c1_*()` on bus 0 of the bit level model, see `sw_instances.c`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#define I2C_SW_INSTANCE         1
+#define I2C_SW_SDA_PORT         PORTD
+#define I2C_SW_SDA_DDR          DDRD
+#define I2C_SW_SDA_READBACK     PIND
+#define I2C_SW_SDA_BIT          0
+#define I2C_SW_SDA_BITPOS       (1 << I2C_SW_SDA_BIT)
+#define I2C_SW_SCL_PORT         PORTD
+#define I2C_SW_SCL_DDR          DDRD
+#define I2C_SW_SCL_READBACK     PIND
+#define I2C_SW_SCL_BIT          4
+#define I2C_SW_SCL_BITPOS       (1 << I2C_SW_SCL_BIT)
+#include "i2c_sw.c"
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : sw_instances.c
+// Description : Runs two instances of the software master against the bus model.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   sw_instances.c
+/// \brief
+/// Functional checks of `i2c_sw_instance.h` on the host.
+/// \details
+/// Built by `make sw-instances`: `i2c_sw.c` is compiled twice, as
+/// `soft_bus1.c` on bus 0 and as `soft_bus2.c` on bus 1 of the bit level
+/// model, both with a slave. The bytes have to arrive on the bus of the
+/// instance, a failure of one instance must not show up at the other.
+/// Returns 0 if all checks pass.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_sw_instance.h"
+#include "parallel_model.h"
+#include <stdio.h>
+
+
+I2C_SW_DECLARE_INSTANCE(1)
+I2C_SW_DECLARE_INSTANCE(2)
+
+
+#define ABSENT_ADDRESS  (0x51 << 1)
+
+
+static unsigned checks;
+static unsigned failures;
+
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        checks++;                                                           \
+        if (!(condition))                                                   \
+        {                                                                   \
+            failures++;                                                     \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);     \
+        }                                                                   \
+    } while (0)
+
+
+static void setup(void)
+{
+    parallel_model_reset(0x03);
+    softI2c1_init();
+    softI2c2_init();
+}
+
+
+static void test_own_bus(void)
+{
+    const uint8_t message1[] = {0x10, 0x11, 0x12, 0x13};
+    const uint8_t message2[] = {0x10, 0x21, 0x22, 0x23};
+    uint8_t readback[3];
+
+    setup();
+    CHECK(softI2c1_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == I2C_SUCCESS);
+    CHECK(parallel_model_selected(0) == PARALLEL_MODEL_ADDRESS);
+    // The other bus just sees SCL toggle.
+    CHECK(!parallel_model_selected(1));
+    CHECK(softI2c1_writeBlock(message1, sizeof(message1)) == I2C_SUCCESS);
+    softI2c1_releaseBus();
+    CHECK(softI2c2_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == I2C_SUCCESS);
+    CHECK(softI2c2_writeBlock(message2, sizeof(message2)) == I2C_SUCCESS);
+    softI2c2_releaseBus();
+    CHECK(parallel_model_memory(0)[0x10] == 0x11);
+    CHECK(parallel_model_memory(0)[0x12] == 0x13);
+    CHECK(parallel_model_memory(1)[0x10] == 0x21);
+    CHECK(parallel_model_memory(1)[0x12] == 0x23);
+
+    CHECK(softI2c1_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == I2C_SUCCESS);
+    softI2c1_putByte(0x10);
+    CHECK(softI2c1_openDevice(PARALLEL_MODEL_ADDRESS | I2C_READ_ACCESS) == I2C_SUCCESS);
+    CHECK(softI2c1_readBlock(readback, sizeof(readback)) == I2C_SUCCESS);
+    softI2c1_releaseBus();
+    CHECK((readback[0] == 0x11) && (readback[1] == 0x12) && (readback[2] == 0x13));
+}
+
+
+static void test_failure_info(void)
+{
+    uint8_t buffer[2] = {0x40, 0x5A};
+
+    setup();
+    // Nobody at this address on bus 1, instance 1 keeps its success.
+    CHECK(softI2c2_openDevice(ABSENT_ADDRESS | I2C_WRITE_ACCESS) == I2C_NO_ACK);
+    softI2c2_releaseBus();
+    CHECK(softI2c2_check4Error() == I2C_NO_ACK);
+    CHECK(softI2c1_check4Error() == I2C_SUCCESS);
+    CHECK(softI2c1_accessDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS, buffer, sizeof(buffer)) == I2C_SUCCESS);
+    CHECK(softI2c2_check4Error() == I2C_NO_ACK);
+    CHECK(parallel_model_memory(0)[0x40] == 0x5A);
+    CHECK(parallel_model_memory(1)[0x40] == 0);
+
+    // And the other way round, the slave of bus 0 refuses the data byte.
+    parallel_model_nack_after(0, 1);
+    CHECK(softI2c1_accessDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS, buffer, sizeof(buffer)) == I2C_NO_ACK);
+    CHECK(softI2c2_check4Error() == I2C_NO_ACK);
+    CHECK(softI2c2_accessDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS, buffer, sizeof(buffer)) == I2C_SUCCESS);
+    CHECK(softI2c2_check4Error() == I2C_SUCCESS);
+    CHECK(softI2c1_check4Error() == I2C_NO_ACK);
+    CHECK(parallel_model_memory(1)[0x40] == 0x5A);
+
+    // A blocked SDA is a matter of its own bus.
+    parallel_model_hold_sda(0x02);
+    softI2c2_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS);
+    softI2c2_releaseBus();
+    CHECK(softI2c2_check4Error() & I2C_SDA_BLOCKED);
+    CHECK(softI2c1_openDevice(PARALLEL_MODEL_ADDRESS | I2C_WRITE_ACCESS) == I2C_SUCCESS);
+    softI2c1_releaseBus();
+    CHECK(softI2c1_check4Error() == I2C_SUCCESS);
+    CHECK(softI2c2_check4Error() & I2C_SDA_BLOCKED);
+    parallel_model_hold_sda(0);
+}
+
+
+int main(void)
+{
+    test_own_bus();
+    test_failure_info();
+    printf("  %u checks, %u failed\n", checks, failures);
+    return(failures ? 1 : 0);
+}
@@ -0,0 +1,731 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : test_runner.c
+// Description : Runs the TWI parts of the lib against the TWI model.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   test_runner.c
+/// \brief
+/// Functional checks and bus cycle counts of the TWI engines on the host.
+/// \details
+/// Built once per operation mode by the Makefile, the mode flags select
+/// the checks just like they select the library implementation.
+/// Returns 0 if all checks pass.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#include "twi_model.h"
+#include <avr/interrupt.h>
+#include <stdio.h>
+#include <string.h>
+
+
+#define SENSOR_ADDRESS      (0x48 << 1)
+#define ABSENT_ADDRESS      (0x30 << 1)
+#define OWN_SLAVE_ADDRESS   (0x22 << 1)
+
+
+static unsigned checks;
+static unsigned failures;
+
+#define CHECK(condition)                                                    \
+    do                                                                      \
+    {                                                                       \
+        checks++;                                                           \
+        if (!(condition))                                                   \
+        {                                                                   \
+            failures++;                                                     \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);     \
+        }                                                                   \
+    } while (0)
+
+
+static uint32_t cyclesMark;
+static uint32_t accessesMark;
+
+
+/// \brief
+/// Start counting for one transaction.
+static void measure(void)
+{
+    cyclesMark = twi_model_bus_cycles();
+    accessesMark = twi_model_register_accesses();
+}
+
+
+/// \brief
+/// Print the counts of the transaction since `measure()`.
+static void report(const char *name, unsigned payload)
+{
+    uint32_t cycles = twi_model_bus_cycles() - cyclesMark;
+    uint32_t accesses = twi_model_register_accesses() - accessesMark;
+    printf("  %-34s %3u bytes %4lu bus cycles %6.1f us @ %lu Hz %5lu register accesses\n",
+           name, payload, (unsigned long)cycles,
+           cycles * 1e6 / F_I2C0_HW, (unsigned long)F_I2C0_HW,
+           (unsigned long)accesses);
+}
+
+
+#if defined I2C0_HW_AS_MASTER
+
+static uint8_t sensorRegisters[16];
+static struct TWI_MODEL_REGISTER_MAP_type sensorMap;
+static struct TWI_MODEL_SLAVE_type sensor;
+
+
+static void setup(void)
+{
+    twi_model_reset();
+    memset(sensorRegisters, 0, sizeof(sensorRegisters));
+    twi_model_register_slave(&sensor, &sensorMap, SENSOR_ADDRESS,
+                             sensorRegisters, sizeof(sensorRegisters));
+    twi_model_attach(&sensor);
+    hardI2c0_init(0, 0, I2C0_BITRATE, I2C0_PRESCALER);
+}
+
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN
+
+static void test_master_byte_and_block(void)
+{
+    uint8_t block[] = {4, 0x11, 0x22, 0x33, 0x44};
+    uint8_t readBack[4] = {0};
+    uint8_t longBlock[300];
+    uint32_t stops;
+    uint16_t i;
+
+    setup();
+    measure();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+    twi_model_sync();
+    report("write block", sizeof(block));
+    CHECK(!memcmp(&sensorRegisters[4], &block[1], 4));
+
+    measure();
+    stops = twi_model_stops();
+    CHECK(hardI2c0_writeRead(SENSOR_ADDRESS, block, 1, readBack, sizeof(readBack)) == I2C_SUCCESS);
+    twi_model_sync();
+    report("write-read (1 + 4)", 1 + sizeof(readBack));
+    CHECK(!memcmp(readBack, &block[1], 4));
+    // Turned around by a repeated START, the one STOP ends the access.
+    CHECK(twi_model_stops() == stops + 1);
+
+    // A block beyond 255 bytes, the register pointer wraps around.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(hardI2c0_writeBlock(block, 1) == I2C_SUCCESS);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS | I2C_READ_ACCESS) == I2C_SUCCESS);
+    memset(longBlock, 0xFF, sizeof(longBlock));
+    CHECK(hardI2c0_readBlock(longBlock, sizeof(longBlock)) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+    for (i = 0; (i < sizeof(longBlock)) && (longBlock[i] == sensorRegisters[(4 + i) % sizeof(sensorRegisters)]); i++) {}
+    CHECK(i == sizeof(longBlock));
+
+    measure();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    hardI2c0_putByteAsMaster(8);
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+    hardI2c0_putByteAsMaster(0x5A);
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    hardI2c0_putByteAsMaster(8);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS | I2C_READ_ACCESS) == I2C_SUCCESS);
+    CHECK(hardI2c0_getByteAsMaster(0) == 0x5A);
+    hardI2c0_releaseBus();
+    twi_model_sync();
+    report("byte wise write + read", 4);
+}
+
+
+static void test_master_no_ack(void)
+{
+    setup();
+    CHECK(hardI2c0_openDevice(ABSENT_ADDRESS) & I2C_NO_ACK);
+    hardI2c0_releaseBus();
+    twi_model_sync();
+}
+
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN && !defined I2C0_HW_SINGLE_MASTER
+
+static void test_multi_master_faults(void)
+{
+    setup();
+    twi_model_inject(TWI_MODEL_ARBITRATION_LOST);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) & I2C_ARBITRATION_LOST);
+
+    setup();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_ARBITRATION_LOST);
+    hardI2c0_putByteAsMaster(0);
+    CHECK(hardI2c0_check4Error() == I2C_ARBITRATION_LOST);
+
+    setup();
+    twi_model_inject(TWI_MODEL_BUS_ERROR);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_PROTOCOL_FAIL);
+    twi_model_sync();
+}
+
+
+static unsigned slotsServed;
+static uint8_t keepLosing;
+
+
+/// \brief
+/// Slave part of the application, called once per backoff slot.
+/// Lets the next attempt lose as well if `keepLosing` is set.
+static void serve_slave(void)
+{
+    slotsServed++;
+    if (keepLosing)
+        twi_model_inject(TWI_MODEL_ARBITRATION_LOST);
+}
+
+
+static void test_open_device_retry(void)
+{
+    uint8_t data[] = {2, 0x5A};
+    unsigned maxSlots = 0;
+    unsigned window = 1;
+    uint8_t i;
+
+    // One lost arbitration, the second attempt wins.
+    setup();
+    slotsServed = 0;
+    keepLosing = 0;
+    twi_model_inject(TWI_MODEL_ARBITRATION_LOST);
+    CHECK(hardI2c0_openDeviceRetry(SENSOR_ADDRESS, serve_slave) == I2C_SUCCESS);
+    CHECK(slotsServed == 1);
+    hardI2c0_writeBlock(data, sizeof(data));
+    hardI2c0_releaseBus();
+    twi_model_sync();
+    CHECK(sensorRegisters[2] == 0x5A);
+
+    // Lost again and again: bounded by the attempts.
+    for (i = 1; i < I2C0_HW_RETRY_ATTEMPTS; i++)
+    {
+        maxSlots += window;
+        if (window < I2C0_HW_BACKOFF_WINDOW)
+            window <<= 1;
+    }
+    setup();
+    slotsServed = 0;
+    keepLosing = ~0;
+    twi_model_inject(TWI_MODEL_ARBITRATION_LOST);
+    CHECK(hardI2c0_openDeviceRetry(SENSOR_ADDRESS, serve_slave) & I2C_ARBITRATION_LOST);
+    CHECK(slotsServed >= I2C0_HW_RETRY_ATTEMPTS - 1);
+    CHECK(slotsServed <= maxSlots);
+    keepLosing = 0;
+    twi_model_sync();
+}
+
+#endif
+
+
+#if defined I2C0_HW_SPEED_SLAVES
+
+static void test_speed_profiles(void)
+{
+    volatile uint8_t *twbr = twi_model_register(TWI_MODEL_TWBR);
+    volatile uint8_t *twsr = twi_model_register(TWI_MODEL_TWSR);
+    uint8_t i;
+
+    setup();
+    CHECK(hardI2c0_setSlaveSpeed(SENSOR_ADDRESS, I2C0_SPEED_400k));
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS | I2C_READ_ACCESS) == I2C_SUCCESS);
+    CHECK(*twbr == I2C0_BITRATE_OF(400000UL));
+    CHECK((*twsr & 0x03) == I2C0_PRESCALER_OF(400000UL));
+    hardI2c0_getByteAsMaster(0);
+    hardI2c0_releaseBus();
+
+    // No profile: back to F_I2C0_HW.
+    CHECK(hardI2c0_openDevice(ABSENT_ADDRESS) & I2C_NO_ACK);
+    CHECK(*twbr == I2C0_BITRATE);
+    CHECK((*twsr & 0x03) == I2C0_PRESCALER);
+    hardI2c0_releaseBus();
+
+    // The entry of the slave gets updated, the R/W-flag does not count.
+    CHECK(hardI2c0_setSlaveSpeed(SENSOR_ADDRESS | I2C_READ_ACCESS, I2C0_SPEED_100k));
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(*twbr == I2C0_BITRATE_OF(100000UL));
+    hardI2c0_releaseBus();
+    twi_model_sync();
+
+    for (i = 1; i < I2C0_HW_SPEED_SLAVES; i++)
+        CHECK(hardI2c0_setSlaveSpeed(ABSENT_ADDRESS + 2 * i, I2C0_SPEED_400k));
+    CHECK(!hardI2c0_setSlaveSpeed(ABSENT_ADDRESS, I2C0_SPEED_400k));
+}
+
+#endif
+
+
+#if defined I2C0_HW_TIMEOUT_TIMER1
+
+// CPU cycles of the timeout, as counted by Timer1.
+#define TIMEOUT_CYCLES  ((uint32_t)I2C0_TIMEOUT_TICKS * I2C0_TIMEOUT_PRESCALER)
+
+#if defined I2C0_HW_BUS_RECOVERY
+// The recovery run by the timeout, no clock needed: the STOP of three
+// half bits at 5 us and the port accesses.
+#   define RECOVERY_CYCLES  (3 * 5 * (F_CPU / 1000000UL) + 32 * TWI_MODEL_ACCESS_CYCLES)
+#else
+#   define RECOVERY_CYCLES  0
+#endif
+
+static uint32_t cpuMark;
+static uint32_t worstLatency;
+
+
+/// \brief
+/// Check the time since `cpuMark` against the timeout: not less than
+/// one tick short, not more than one tick late plus `busCycles` spent
+/// on the bus before the stuck operation, a few register accesses and
+/// the recovery, if any.
+static void check_latency(uint8_t busCycles)
+{
+    uint32_t latency = twi_model_cpu_cycles() - cpuMark;
+    CHECK(latency + I2C0_TIMEOUT_PRESCALER >= TIMEOUT_CYCLES);
+    CHECK(latency <= TIMEOUT_CYCLES + I2C0_TIMEOUT_PRESCALER + RECOVERY_CYCLES
+                     + busCycles * (F_CPU / F_I2C0_HW) + 16 * TWI_MODEL_ACCESS_CYCLES);
+    if (latency > worstLatency)
+        worstLatency = latency;
+}
+
+
+static void test_stuck_scl(void)
+{
+    uint8_t block[] = {2, 0x11, 0x22};
+    uint8_t readBack[2];
+
+    // Stuck at the START.
+    setup();
+    worstLatency = 0;
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) & I2C_TIMED_OUT);
+    check_latency(0);
+    hardI2c0_releaseBus();
+    // The TWI got reset, the bus works again.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+
+    // Stuck within a block written.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) & I2C_TIMED_OUT);
+    check_latency(0);
+    hardI2c0_releaseBus();
+
+    // Stuck within a block read.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS | I2C_READ_ACCESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_readBlock(readBack, sizeof(readBack)) & I2C_TIMED_OUT);
+    check_latency(0);
+    hardI2c0_releaseBus();
+
+    // Stuck at a single byte.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    cpuMark = twi_model_cpu_cycles();
+    hardI2c0_putByteAsMaster(0);
+    CHECK(hardI2c0_check4Error() & I2C_TIMED_OUT);
+    check_latency(0);
+    hardI2c0_releaseBus();
+
+#if !defined I2C0_HW_SINGLE_MASTER
+    // Another master holds the bus for longer than the timeout. The START
+    // waits for it, that is no failure.
+    twi_model_bus_busy(3 * I2C0_HW_EMERGENCY_TIMEOUT_us);
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(twi_model_cpu_cycles() - cpuMark >= 3 * TIMEOUT_CYCLES);
+    hardI2c0_releaseBus();
+#endif
+
+    // Nothing left stuck.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+    CHECK(hardI2c0_writeRead(SENSOR_ADDRESS, block, 1, readBack, sizeof(readBack)) == I2C_SUCCESS);
+    CHECK(readBack[0] == 0x11);
+    twi_model_sync();
+
+    printf("  %-34s %lu us limit, worst %.1f us, %lu ticks at F_CPU/%u\n",
+           "stuck SCL timeout", (unsigned long)I2C0_HW_EMERGENCY_TIMEOUT_us,
+           worstLatency * 1e6 / F_CPU,
+           (unsigned long)I2C0_TIMEOUT_TICKS, (unsigned)I2C0_TIMEOUT_PRESCALER);
+}
+
+#endif
+
+
+#if defined I2C0_HW_BUS_RECOVERY
+
+/// \brief
+/// Recover the bus from a slave keeping SDA low for `clocks` clocks.
+/// \details
+/// The clocks counted include the one of the STOP.
+/// \returns the time taken in us.
+static double recover(uint8_t clocks, enum I2C_FAILURE_type expected)
+{
+    uint32_t clocksMark, stopsMark, start;
+
+    twi_model_sync();
+    twi_model_hold_sda(clocks);
+    clocksMark = twi_model_recovery_clocks();
+    stopsMark = twi_model_stops();
+    start = twi_model_cpu_cycles();
+    CHECK(hardI2c0_recoverBus() == expected);
+    if (clocks == TWI_MODEL_SDA_STUCK)
+        clocks = 9;
+    CHECK(twi_model_recovery_clocks() - clocksMark == clocks + 1u);
+    CHECK(twi_model_stops() - stopsMark == (expected == I2C_SUCCESS));
+    return((twi_model_cpu_cycles() - start) * 1e6 / F_CPU);
+}
+
+
+static void test_bus_recovery(void)
+{
+    uint8_t block[] = {2, 0x11, 0x22};
+    uint8_t readBack[2];
+    uint32_t clocksMark;
+    double shortest, longest;
+
+    setup();
+    shortest = recover(1, I2C_SUCCESS);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+    longest = recover(9, I2C_SUCCESS);
+    CHECK(hardI2c0_writeBlock(block, 0) == I2C_SUCCESS);
+    // Nobody lets SDA go.
+    recover(TWI_MODEL_SDA_STUCK, I2C_SDA_BLOCKED);
+    CHECK(hardI2c0_check4Error() == I2C_SDA_BLOCKED);
+    recover(0, I2C_SUCCESS);
+
+#if defined I2C0_HW_SINGLE_MASTER
+    // Held since the reset of the MCU, the init clocks it out.
+    twi_model_reset();
+    twi_model_attach(&sensor);
+    twi_model_hold_sda(4);
+    hardI2c0_init(0, 0, I2C0_BITRATE, I2C0_PRESCALER);
+    CHECK(twi_model_recovery_clocks() == 4 + 1);
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+
+    // Held before the START, the open clocks it out.
+    twi_model_hold_sda(3);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(twi_model_recovery_clocks() == 5 + 3 + 1);
+    hardI2c0_releaseBus();
+    twi_model_hold_sda(TWI_MODEL_SDA_STUCK);
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SDA_BLOCKED);
+    twi_model_hold_sda(0);
+#endif
+
+    // A slave stuck within a byte keeps SCL, then SDA low: the timeout
+    // of the single master recovers the bus. A multi master leaves the
+    // bus alone, another master may be using it.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    twi_model_hold_sda(5);
+    clocksMark = twi_model_recovery_clocks();
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) & I2C_TIMED_OUT);
+#if defined I2C0_HW_SINGLE_MASTER
+    CHECK(twi_model_recovery_clocks() - clocksMark == 5 + 1);
+    hardI2c0_releaseBus();
+
+    // The slave keeps SCL low even with the TWI off: no second wait for
+    // it, no recovery clocks.
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    twi_model_inject(TWI_MODEL_SCL_STUCK);
+    twi_model_hold_scl(3 * I2C0_HW_EMERGENCY_TIMEOUT_us);
+    clocksMark = twi_model_recovery_clocks();
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) & I2C_TIMED_OUT);
+    check_latency(0);
+    CHECK(twi_model_recovery_clocks() == clocksMark);
+    // The recovery gives up after one timeout as well.
+    cpuMark = twi_model_cpu_cycles();
+    CHECK(hardI2c0_recoverBus() == I2C_TIMED_OUT);
+    check_latency(0);
+    CHECK(twi_model_recovery_clocks() == clocksMark);
+    twi_model_delay_us(I2C0_HW_EMERGENCY_TIMEOUT_us);
+    CHECK(hardI2c0_recoverBus() == I2C_SUCCESS);
+#else
+    CHECK(twi_model_recovery_clocks() == clocksMark);
+    CHECK(hardI2c0_recoverBus() == I2C_SUCCESS);
+#endif
+    hardI2c0_releaseBus();
+    CHECK(hardI2c0_openDevice(SENSOR_ADDRESS) == I2C_SUCCESS);
+    CHECK(hardI2c0_writeBlock(block, sizeof(block)) == I2C_SUCCESS);
+    hardI2c0_releaseBus();
+    CHECK(hardI2c0_writeRead(SENSOR_ADDRESS, block, 1, readBack, sizeof(readBack)) == I2C_SUCCESS);
+    CHECK(readBack[0] == 0x11);
+    twi_model_sync();
+
+    printf("  %-34s 1 clock %.1f us, 9 clocks %.1f us\n",
+           "bus recovery", shortest, longest);
+}
+
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && defined I2C0_HW_INTERRUPT_DRIVEN
+
+static void test_interrupt_master(void)
+{
+    uint8_t block[] = {2, 0xA1, 0xA2, 0xA3};
+    uint8_t readBack[3] = {0};
+    uint8_t longBlock[300];
+    uint16_t i;
+
+    setup();
+    sei();
+    measure();
+    CHECK(hardI2c0_startTransaction(SENSOR_ADDRESS, block, sizeof(block), 0, 0));
+    CHECK(!hardI2c0_startTransaction(SENSOR_ADDRESS, block, sizeof(block), 0, 0));
+    while (hardI2c0_isBusy()) {}
+    twi_model_sync();
+    report("transaction write", sizeof(block));
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+    CHECK(!memcmp(&sensorRegisters[2], &block[1], 3));
+
+    measure();
+    CHECK(hardI2c0_startTransaction(SENSOR_ADDRESS, block, 1, readBack, sizeof(readBack)));
+    while (hardI2c0_isBusy()) {}
+    twi_model_sync();
+    report("transaction write-read (1 + 3)", 1 + sizeof(readBack));
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+    CHECK(!memcmp(readBack, &block[1], 3));
+
+    // A read part beyond 255 bytes, the register pointer wraps around.
+    memset(longBlock, 0xFF, sizeof(longBlock));
+    CHECK(hardI2c0_startTransaction(SENSOR_ADDRESS, block, 1, longBlock, sizeof(longBlock)));
+    while (hardI2c0_isBusy()) {}
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+    for (i = 0; (i < sizeof(longBlock)) && (longBlock[i] == sensorRegisters[(2 + i) % sizeof(sensorRegisters)]); i++) {}
+    CHECK(i == sizeof(longBlock));
+
+    CHECK(hardI2c0_startTransaction(ABSENT_ADDRESS, block, 1, 0, 0));
+    while (hardI2c0_isBusy()) {}
+    CHECK(hardI2c0_check4Error() & I2C_NO_ACK);
+}
+
+
+static void test_interrupt_master_status(void)
+{
+    struct I2C_STATUS_type absent, present;
+    uint8_t block[] = {5, 0xB1};
+    uint8_t readBack = 0;
+
+    setup();
+    sei();
+    CHECK(hardI2c0_submitTransaction(ABSENT_ADDRESS, block, 1, 0, 0, &absent));
+    CHECK(absent.pending);
+#if !defined I2C0_HW_QUEUE_SIZE
+    CHECK(!hardI2c0_submitTransaction(SENSOR_ADDRESS, block, 1, 0, 0, &present));
+#endif
+    // The model advances on register accesses only, so wait by the TWI.
+    while (hardI2c0_isBusy()) {}
+    CHECK(!absent.pending);
+    CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, block, sizeof(block), 0, 0, &present));
+    while (hardI2c0_isBusy()) {}
+    twi_model_sync();
+    CHECK(!present.pending);
+    // Each record keeps the outcome of its own transaction.
+    CHECK(absent.failure == I2C_NO_ACK);
+    CHECK(present.failure == I2C_SUCCESS);
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+
+    CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, block, 1, &readBack, 1, &present));
+    while (hardI2c0_isBusy()) {}
+    CHECK(!present.pending);
+    CHECK(present.failure == I2C_SUCCESS);
+    CHECK(readBack == 0xB1);
+}
+
+#endif
+
+
+#if defined I2C0_HW_QUEUE_SIZE
+
+static void test_queued_master(void)
+{
+    struct I2C_STATUS_type status[I2C0_HW_QUEUE_SIZE];
+    uint8_t first[] = {8, 0xC1, 0xC2};
+    uint8_t second[] = {10, 0xC3};
+    uint8_t pointer = 8;
+    uint8_t readBack[3] = {0};
+    uint32_t stops;
+    uint8_t i;
+
+    setup();
+    sei();
+    measure();
+    stops = twi_model_stops();
+    // Three slots of four, the running transaction included.
+    CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, first, sizeof(first), 0, 0, &status[0]));
+    CHECK(hardI2c0_submitTransaction(ABSENT_ADDRESS, first, 1, 0, 0, &status[1]));
+    CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, second, sizeof(second), 0, 0, &status[2]));
+    CHECK(!hardI2c0_submitTransaction(SENSOR_ADDRESS, second, sizeof(second), 0, 0, &status[3]));
+    while (hardI2c0_isBusy()) {}
+    twi_model_sync();
+    report("queued writes (3 + 1 + 2)", sizeof(first) + 1 + sizeof(second));
+#if defined I2C0_HW_CHAIN_TRANSACTIONS
+    // Linked by repeated START, one STOP at the end.
+    CHECK(twi_model_stops() - stops == 1);
+#else
+    CHECK(twi_model_stops() - stops == 3);
+#endif
+    for (i = 0; i < 3; i++)
+        CHECK(!status[i].pending);
+    CHECK(status[0].failure == I2C_SUCCESS);
+    CHECK(status[1].failure == I2C_NO_ACK);
+    CHECK(status[2].failure == I2C_SUCCESS);
+    CHECK(!memcmp(&sensorRegisters[8], &first[1], 2));
+    CHECK(sensorRegisters[10] == 0xC3);
+
+    // The queue wraps around.
+    for (i = 0; i < 2; i++)
+    {
+        CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, &pointer, 1, readBack, sizeof(readBack), &status[0]));
+        while (hardI2c0_isBusy()) {}
+        CHECK(!status[0].pending && (status[0].failure == I2C_SUCCESS));
+    }
+    CHECK(readBack[0] == 0xC1 && readBack[1] == 0xC2 && readBack[2] == 0xC3);
+
+    // The internal record takes one transaction at a time, the queue
+    // still takes those with a record of their own.
+    CHECK(hardI2c0_startTransaction(SENSOR_ADDRESS, first, sizeof(first), 0, 0));
+    CHECK(!hardI2c0_startTransaction(ABSENT_ADDRESS, first, 1, 0, 0));
+    CHECK(hardI2c0_submitTransaction(SENSOR_ADDRESS, second, sizeof(second), 0, 0, &status[1]));
+    while (hardI2c0_isBusy()) {}
+    CHECK(!status[1].pending && (status[1].failure == I2C_SUCCESS));
+    CHECK(hardI2c0_startTransaction(SENSOR_ADDRESS, first, sizeof(first), 0, 0));
+    while (hardI2c0_isBusy()) {}
+    CHECK(hardI2c0_check4Error() == I2C_SUCCESS);
+}
+
+#endif
+
+
+#if defined I2C0_HW_AS_SLAVE && !defined I2C0_HW_AS_MASTER && defined I2C0_HW_INTERRUPT_DRIVEN
+
+/// \brief
+/// Let the scripted remote master run while the application polls.
+/// \returns ~0 once the slave has reported the transfer.
+static uint8_t remote_transfer(uint8_t deviceAddress, uint8_t *buffer, uint16_t length,
+                               uint8_t *addressReceived, uint8_t *byteCount)
+{
+    uint8_t done = 0;
+    twi_model_remote_master(deviceAddress, buffer, length);
+    while (!twi_model_remote_master_done() || !done)
+    {
+        // Bus events happen while the application polls.
+        twi_model_sync();
+        if (hardI2c0_slaveTransferDone(addressReceived, byteCount))
+            done = ~0;
+    }
+    return(done);
+}
+
+
+static void test_interrupt_slave(void)
+{
+    uint8_t registers[8] = {0};
+    uint8_t rx[2], tx[2] = {0xC1, 0xC2};
+    uint8_t script[4];
+    uint8_t stream[258];
+    uint8_t address, count;
+
+    twi_model_reset();
+    hardI2c0_init(OWN_SLAVE_ADDRESS, 0, 0, 0);
+    CHECK(hardI2c0_setSlaveRegisterFile(registers, sizeof(registers)));
+    sei();
+
+    script[0] = 6; script[1] = 0x61; script[2] = 0x62; script[3] = 0x63;
+    measure();
+    remote_transfer(OWN_SLAVE_ADDRESS, script, 4, &address, &count);
+    report("register file write (1 + 3)", 4);
+    CHECK(address == OWN_SLAVE_ADDRESS);
+    CHECK(count == 4);
+    CHECK((registers[6] == 0x61) && (registers[7] == 0x62) && (registers[0] == 0x63));
+
+    script[0] = 7;
+    remote_transfer(OWN_SLAVE_ADDRESS, script, 1, &address, &count);
+    measure();
+    remote_transfer(OWN_SLAVE_ADDRESS | I2C_READ_ACCESS, script, 2, &address, &count);
+    report("register file read", 2);
+    CHECK(address == (OWN_SLAVE_ADDRESS | I2C_READ_ACCESS));
+    CHECK((script[0] == 0x62) && (script[1] == 0x63));
+
+    // The byte count wraps within this write, the bytes after the wrap
+    // still are data and not a new register pointer.
+    for (uint16_t i = 0; i < sizeof(stream); i++)
+        stream[i] = i;
+    remote_transfer(OWN_SLAVE_ADDRESS, stream, sizeof(stream), &address, &count);
+    CHECK(count == (uint8_t)sizeof(stream));
+    CHECK((registers[1] == 0xFA) && (registers[7] == 0x00) && (registers[0] == 0x01));
+    CHECK(hardI2c0_setSlaveRegisterFile(registers, 0) == 0);
+    script[0] = 2;
+    remote_transfer(OWN_SLAVE_ADDRESS, script, 1, &address, &count);
+    remote_transfer(OWN_SLAVE_ADDRESS | I2C_READ_ACCESS, script, 1, &address, &count);
+    CHECK(script[0] == registers[2]);
+
+    hardI2c0_setSlaveBuffers(rx, sizeof(rx), tx, sizeof(tx));
+    script[0] = 0x71; script[1] = 0x72; script[2] = 0x73;
+    remote_transfer(OWN_SLAVE_ADDRESS, script, 3, &address, &count);
+    CHECK(count == 2);
+    CHECK((rx[0] == 0x71) && (rx[1] == 0x72));
+    remote_transfer(OWN_SLAVE_ADDRESS | I2C_READ_ACCESS, script, 3, &address, &count);
+    CHECK((script[0] == 0xC1) && (script[1] == 0xC2) && (script[2] == 0xFF));
+}
+
+#endif
+
+
+int main(void)
+{
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN
+    test_master_byte_and_block();
+    test_master_no_ack();
+#endif
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_INTERRUPT_DRIVEN && !defined I2C0_HW_SINGLE_MASTER
+    test_multi_master_faults();
+    test_open_device_retry();
+#endif
+#if defined I2C0_HW_SPEED_SLAVES
+    test_speed_profiles();
+#endif
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    test_stuck_scl();
+#endif
+#if defined I2C0_HW_BUS_RECOVERY
+    test_bus_recovery();
+#endif
+#if defined I2C0_HW_AS_MASTER && defined I2C0_HW_INTERRUPT_DRIVEN
+    test_interrupt_master();
+    test_interrupt_master_status();
+#endif
+#if defined I2C0_HW_QUEUE_SIZE
+    test_queued_master();
+#endif
+#if defined I2C0_HW_AS_SLAVE && !defined I2C0_HW_AS_MASTER && defined I2C0_HW_INTERRUPT_DRIVEN
+    test_interrupt_slave();
+#endif
+    printf("  %u checks, %u failed\n", checks, failures);
+    return(failures ? 1 : 0);
+}
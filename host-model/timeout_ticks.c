@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : timeout_ticks.c
+// Description : Timer1 ticks of the TWI timeout with a 32 bit long.
+// Author      : 
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   : 
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   timeout_ticks.c
+/// \brief
+/// Compile time check of `I2C0_TIMEOUT_TICKS` and `I2C0_TIMEOUT_PRESCALER`.
+/// \details
+/// Built by `make timeout-ticks` with `-m32`, so `unsigned long` has 32
+/// bits like on the AVR, once per `F_CPU` and timeout. `EXPECTED_TICKS`
+/// and `EXPECTED_PRESCALER` give the result worked out by hand. The check
+/// fails the build, there is nothing to run.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+
+
+_Static_assert(sizeof(unsigned long) == 4, "Build with -m32, the AVR has a 32 bit long");
+_Static_assert(I2C0_TIMEOUT_PRESCALER == EXPECTED_PRESCALER, "Timer1 prescaler");
+_Static_assert(I2C0_TIMEOUT_TICKS == EXPECTED_TICKS, "Timer1 ticks of the timeout");
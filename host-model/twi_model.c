@@ -0,0 +1,733 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi_model.c
+// Description : Behavioral model of the AVR TWI for host builds.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi_model.c
+/// \brief  Behavioral model of the TWI, see `twi_model.h`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "twi_model.h"
+#include <stddef.h>
+
+
+// TWCR bits, same as on the AVR.
+#define TWINT   7
+#define TWEA    6
+#define TWSTA   5
+#define TWSTO   4
+#define TWEN    2
+#define TWIE    0
+
+// Reserved TWCR bit, reads '1' from the model, see `twi_model.h`.
+#define TWI_MODEL_UNTOUCHED     (1 << 1)
+
+// TIFR1 bit, same as on the AVR, and the reserved one reading '1'.
+#define OCF1B                   2
+#define TIMER_MODEL_UNTOUCHED   (1 << 7)
+
+#define TWI_MODEL_MAX_SLAVES    8
+
+// Port C pins of the TWI, as on the ATmega168.
+#define GPIO_SCL                (1 << 5)
+#define GPIO_SDA                (1 << 4)
+
+
+/// \brief
+/// Role of the TWI on the bus.
+enum TWI_MODEL_MODE_type
+{
+    MODEL_BUS_FREE = 0,         ///< Not involved in a transfer.
+    MODEL_MASTER_START,         ///< START sent, next is the address field.
+    MODEL_MASTER_WRITE,         ///< Master transmitter.
+    MODEL_MASTER_READ,          ///< Master receiver.
+    MODEL_SLAVE_RECEIVE,        ///< Addressed by the remote master for write.
+    MODEL_SLAVE_TRANSMIT        ///< Addressed by the remote master for read.
+};
+
+
+// ISR(TWI_vect) of the library, if linked.
+void twi_model_isr(void) __attribute__((weak));
+
+uint8_t twi_model_sreg;
+uint8_t twi_model_gpior0;
+
+static volatile uint8_t reg[TWI_MODEL_REGISTER_COUNT];
+static uint8_t twcrVisible;
+static uint8_t control;
+static uint8_t status;
+static uint8_t interruptFlag;
+static uint8_t mode;
+static uint8_t inIsr;
+static uint8_t fault;
+static struct TWI_MODEL_SLAVE_type *slaves[TWI_MODEL_MAX_SLAVES];
+static uint8_t slaveCount;
+static struct TWI_MODEL_SLAVE_type *selected;
+static uint32_t busCycles;
+static uint32_t accesses;
+static uint32_t stops;
+static uint32_t cpuCycles;
+
+static volatile uint16_t timerReg[TWI_MODEL_TIMER_COUNT];
+static uint16_t timerCount;
+static uint8_t timerFlags;
+static uint32_t timerCycles;
+
+static volatile uint8_t gpioReg[TWI_MODEL_GPIO_COUNT];
+static uint8_t sclLow;
+static uint8_t sdaLow;
+static uint8_t sdaHeld;
+static uint8_t sclStuck;
+static uint8_t startPending;
+static uint32_t busyUntil;
+static uint32_t sclHeldUntil;
+static uint32_t recoveryClocks;
+
+static struct
+{
+    uint8_t pending;
+    uint8_t done;
+    uint8_t address;
+    uint8_t *buffer;
+    uint16_t length;
+    uint16_t index;
+    uint8_t generalCall;
+} remote;
+
+
+/// \brief
+/// Check if the address field selects the TWI as a slave.
+static uint8_t own_address_matches(uint8_t address)
+{
+    if (!(control & (1 << TWEA)))
+        return(0);
+    if (!(address & 0xFE))
+        return(reg[TWI_MODEL_TWAR] & 0x01);
+    return(((address ^ reg[TWI_MODEL_TWAR]) & ~reg[TWI_MODEL_TWAMR] & 0xFE) == 0);
+}
+
+
+/// \brief
+/// The remote master addresses the TWI.
+/// \details
+/// `lostArbitration` selects the status codes reported when the TWI just
+/// has lost arbitration as a master.
+/// \returns ~0 if the TWI is addressed, 0 if not.
+static uint8_t remote_start(uint8_t lostArbitration)
+{
+    uint8_t address = remote.address;
+    if (!own_address_matches(address))
+        return(0);
+    busCycles += 1 + 9;
+    remote.pending = 0;
+    remote.index = 0;
+    remote.generalCall = !(address & 0xFE);
+    reg[TWI_MODEL_TWDR] = address;
+    if (address & 0x01)
+    {
+        mode = MODEL_SLAVE_TRANSMIT;
+        status = lostArbitration ? 0xB0 : 0xA8;
+    }
+    else
+    {
+        mode = MODEL_SLAVE_RECEIVE;
+        if (remote.generalCall)
+            status = lostArbitration ? 0x78 : 0x70;
+        else
+            status = lostArbitration ? 0x68 : 0x60;
+    }
+    interruptFlag = 1;
+    return(~0);
+}
+
+
+/// \brief
+/// The remote master runs a transfer not addressing the TWI.
+static void remote_elsewhere(void)
+{
+    busCycles += 1 + 9 * (1 + remote.length) + 1;
+    remote.pending = 0;
+    remote.done = ~0;
+}
+
+
+/// \brief
+/// The remote master finishes; the TWI returns to not addressed.
+static void remote_finish(void)
+{
+    busCycles++;
+    remote.done = ~0;
+    mode = MODEL_BUS_FREE;
+    status = 0xF8;
+}
+
+
+/// \brief
+/// Next bus event of the remote master after TWINT has been cleared.
+static void remote_continue(void)
+{
+    if (mode == MODEL_SLAVE_RECEIVE)
+    {
+        switch (status)
+        {
+            case 0x88:
+            case 0x98:
+                // NACK returned, remote master stops.
+                remote_finish();
+                return;
+            case 0xA0:
+                mode = MODEL_BUS_FREE;
+                status = 0xF8;
+                return;
+        }
+        if (remote.index < remote.length)
+        {
+            uint8_t ack = control & (1 << TWEA);
+            busCycles += 9;
+            reg[TWI_MODEL_TWDR] = remote.buffer[remote.index++];
+            if (remote.generalCall)
+                status = ack ? 0x90 : 0x98;
+            else
+                status = ack ? 0x80 : 0x88;
+        }
+        else
+        {
+            // All bytes sent, STOP.
+            busCycles++;
+            remote.done = ~0;
+            status = 0xA0;
+        }
+        interruptFlag = 1;
+        return;
+    }
+    // MODEL_SLAVE_TRANSMIT
+    if ((status == 0xC0) || (status == 0xC8))
+    {
+        remote_finish();
+        return;
+    }
+    busCycles += 9;
+    if (remote.index < remote.length)
+        remote.buffer[remote.index++] = reg[TWI_MODEL_TWDR];
+    if (remote.index < remote.length)
+        status = (control & (1 << TWEA)) ? 0xB8 : 0xC8;
+    else
+        status = 0xC0;
+    interruptFlag = 1;
+}
+
+
+/// \brief
+/// Master lost arbitration in the address field or a data byte.
+static void master_lost_arbitration(uint8_t addressField)
+{
+    busCycles += 9;
+    selected = NULL;
+    mode = MODEL_BUS_FREE;
+    if (addressField && remote.pending && remote_start(~0))
+        return;
+    status = 0x38;
+    interruptFlag = 1;
+}
+
+
+/// \brief
+/// Carry out the bus operation requested by writing TWINT.
+static void execute(void)
+{
+    if (fault == TWI_MODEL_SCL_STUCK)
+    {
+        // TWINT stays cleared and SCL low until the TWI gets disabled.
+        fault = TWI_MODEL_NO_FAULT;
+        sclStuck = 1;
+        return;
+    }
+    if (control & (1 << TWSTO))
+    {
+        if ((mode == MODEL_MASTER_START) || (mode == MODEL_MASTER_WRITE) || (mode == MODEL_MASTER_READ))
+        {
+            busCycles++;
+            stops++;
+            if (selected && selected->stop)
+                selected->stop(selected);
+        }
+        selected = NULL;
+        mode = MODEL_BUS_FREE;
+        status = 0xF8;
+        control &= ~(1 << TWSTO);
+        if (!(control & (1 << TWSTA)))
+            return;
+    }
+    if (control & (1 << TWSTA))
+    {
+        if ((mode == MODEL_BUS_FREE) && (twi_model_cpu_cycles() < busyUntil))
+        {
+            // Another master holds the bus, the START waits.
+            startPending = 1;
+            return;
+        }
+        if (fault == TWI_MODEL_BUS_ERROR)
+        {
+            fault = TWI_MODEL_NO_FAULT;
+            mode = MODEL_BUS_FREE;
+            status = 0x00;
+            interruptFlag = 1;
+            return;
+        }
+        if ((mode == MODEL_MASTER_START) || (mode == MODEL_MASTER_WRITE) || (mode == MODEL_MASTER_READ))
+        {
+            if (selected && selected->stop)
+                selected->stop(selected);
+            status = 0x10;
+        }
+        else
+            status = 0x08;
+        selected = NULL;
+        busCycles++;
+        mode = MODEL_MASTER_START;
+        interruptFlag = 1;
+        return;
+    }
+    switch (mode)
+    {
+        case MODEL_MASTER_START:
+        {
+            uint8_t address = reg[TWI_MODEL_TWDR];
+            if (fault == TWI_MODEL_ARBITRATION_LOST)
+            {
+                fault = TWI_MODEL_NO_FAULT;
+                master_lost_arbitration(~0);
+                return;
+            }
+            busCycles += 9;
+            selected = NULL;
+            for (uint8_t i = 0; i < slaveCount; i++)
+                if (slaves[i]->address == (address & 0xFE))
+                    selected = slaves[i];
+            if (address & 0x01)
+            {
+                mode = MODEL_MASTER_READ;
+                status = selected ? 0x40 : 0x48;
+            }
+            else
+            {
+                mode = MODEL_MASTER_WRITE;
+                status = selected ? 0x18 : 0x20;
+            }
+            break;
+        }
+        case MODEL_MASTER_WRITE:
+            if (fault == TWI_MODEL_ARBITRATION_LOST)
+            {
+                fault = TWI_MODEL_NO_FAULT;
+                master_lost_arbitration(0);
+                return;
+            }
+            busCycles += 9;
+            if (selected && selected->write(selected, reg[TWI_MODEL_TWDR]))
+                status = 0x28;
+            else
+                status = 0x30;
+            break;
+        case MODEL_MASTER_READ:
+            busCycles += 9;
+            reg[TWI_MODEL_TWDR] = selected ? selected->read(selected) : 0xFF;
+            status = (control & (1 << TWEA)) ? 0x50 : 0x58;
+            break;
+        case MODEL_SLAVE_RECEIVE:
+        case MODEL_SLAVE_TRANSMIT:
+            remote_continue();
+            return;
+        default:
+            // Not addressed, e. g. released after arbitration loss.
+            status = 0xF8;
+            return;
+    }
+    interruptFlag = 1;
+}
+
+
+/// \brief
+/// Process a value written to TWCR.
+static void written(uint8_t value)
+{
+    control = value & ~((1 << TWINT) | TWI_MODEL_UNTOUCHED);
+    if (!(value & (1 << TWEN)))
+    {
+        sclStuck = 0;
+        startPending = 0;
+        selected = NULL;
+        mode = MODEL_BUS_FREE;
+        interruptFlag = 0;
+        status = 0xF8;
+        return;
+    }
+    if (!(value & (1 << TWINT)))
+        return;
+    // Writing '1' clears TWINT and starts the next operation.
+    interruptFlag = 0;
+    execute();
+}
+
+
+/// \brief
+/// Update the register contents read by the library.
+static void present(void)
+{
+    twcrVisible = control | TWI_MODEL_UNTOUCHED;
+    if (interruptFlag)
+        twcrVisible |= (1 << TWINT);
+    reg[TWI_MODEL_TWCR] = twcrVisible;
+    reg[TWI_MODEL_TWSR] = status | (reg[TWI_MODEL_TWSR] & 0x03);
+}
+
+
+/// \brief
+/// Synchronize the model with the accesses of the library.
+void twi_model_sync(void)
+{
+    uint8_t value = reg[TWI_MODEL_TWCR];
+    if ((value != twcrVisible) || !(value & TWI_MODEL_UNTOUCHED))
+        written(value);
+    if (startPending && (twi_model_cpu_cycles() >= busyUntil))
+    {
+        startPending = 0;
+        execute();
+    }
+    if ((mode == MODEL_BUS_FREE) && !interruptFlag && remote.pending && (control & (1 << TWEN)))
+    {
+        if (!remote_start(0))
+            remote_elsewhere();
+    }
+    present();
+    if (interruptFlag && (control & (1 << TWIE)) && (twi_model_sreg & 0x80) && !inIsr && twi_model_isr)
+    {
+        inIsr = 1;
+        twi_model_isr();
+        inIsr = 0;
+        value = reg[TWI_MODEL_TWCR];
+        if ((value != twcrVisible) || !(value & TWI_MODEL_UNTOUCHED))
+            written(value);
+        present();
+    }
+}
+
+
+/// \brief
+/// Access to a register, synchronizes the model first.
+volatile uint8_t *twi_model_register(uint8_t index)
+{
+    accesses++;
+    cpuCycles += TWI_MODEL_ACCESS_CYCLES;
+    twi_model_sync();
+    return(&reg[index]);
+}
+
+
+/// \brief
+/// Run Timer1 up to the CPU time now, take the writes of the library.
+static void timer_sync(void)
+{
+    static const uint16_t prescale[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+    uint16_t divider = prescale[timerReg[TWI_MODEL_TCCR1B] & 0x07];
+    uint32_t now = twi_model_cpu_cycles();
+
+    if (timerReg[TWI_MODEL_TCNT1] != timerCount)
+        timerCount = timerReg[TWI_MODEL_TCNT1];
+    if (!(timerReg[TWI_MODEL_TIFR1] & TIMER_MODEL_UNTOUCHED))
+        // Writing '1' clears a flag.
+        timerFlags &= ~timerReg[TWI_MODEL_TIFR1];
+    if (!divider)
+        // Stopped.
+        timerCycles = now;
+    while (divider && (now - timerCycles >= divider))
+    {
+        timerCycles += divider;
+        if (++timerCount == timerReg[TWI_MODEL_OCR1B])
+            timerFlags |= (1 << OCF1B);
+    }
+    timerReg[TWI_MODEL_TCNT1] = timerCount;
+    timerReg[TWI_MODEL_TIFR1] = timerFlags | TIMER_MODEL_UNTOUCHED;
+}
+
+
+/// \brief
+/// Access to a Timer1 register, runs the timer first.
+volatile uint16_t *twi_model_timer(uint8_t index)
+{
+    cpuCycles += TWI_MODEL_ACCESS_CYCLES;
+    timer_sync();
+    return(&timerReg[index]);
+}
+
+
+/// \brief
+/// Take the port C writes of the library, follow SCL and SDA.
+/// \details
+/// The slave holding SDA lets go at the rising SCL edge ending its hold.
+/// SDA rising while SCL stays high is a STOP.
+static void gpio_sync(void)
+{
+    uint8_t driven = gpioReg[TWI_MODEL_DDRC] & ~gpioReg[TWI_MODEL_PORTC];
+    uint32_t now;
+    uint8_t scl, sda;
+
+    twi_model_sync();
+    if (control & (1 << TWEN))
+        // The TWI takes the pins, released between its operations.
+        driven &= ~(GPIO_SCL | GPIO_SDA);
+    now = twi_model_cpu_cycles();
+    if (sclStuck || (now < sclHeldUntil))
+        driven |= GPIO_SCL;
+    else if ((now < busyUntil) && ((now / (F_CPU / F_I2C0_HW / 2)) & 1))
+        // The clock of the master holding the bus.
+        driven |= GPIO_SCL;
+    scl = driven & GPIO_SCL;
+    if (sclLow && !scl)
+    {
+        recoveryClocks++;
+        if (sdaHeld && (sdaHeld != TWI_MODEL_SDA_STUCK))
+            sdaHeld--;
+    }
+    sda = (driven & GPIO_SDA) || sdaHeld;
+    if (!sclLow && !scl && sdaLow && !sda)
+        stops++;
+    sclLow = scl;
+    sdaLow = sda ? GPIO_SDA : 0;
+    gpioReg[TWI_MODEL_PINC] = ~((scl ? GPIO_SCL : 0) | sdaLow);
+}
+
+
+/// \brief
+/// Access to a port C register, takes the writes since the last one.
+volatile uint8_t *twi_model_gpio(uint8_t index)
+{
+    cpuCycles += TWI_MODEL_ACCESS_CYCLES;
+    gpio_sync();
+    return(&gpioReg[index]);
+}
+
+
+/// \brief
+/// `_delay_us()` of the library, lets the CPU time pass.
+void twi_model_delay_us(uint32_t us)
+{
+    cpuCycles += us * (F_CPU / 1000000UL);
+}
+
+
+/// \brief
+/// Put the model into its power on state, detach all slaves.
+void twi_model_reset(void)
+{
+    for (uint8_t i = 0; i < TWI_MODEL_REGISTER_COUNT; i++)
+        reg[i] = 0;
+    control = 0;
+    status = 0xF8;
+    interruptFlag = 0;
+    mode = MODEL_BUS_FREE;
+    inIsr = 0;
+    fault = TWI_MODEL_NO_FAULT;
+    slaveCount = 0;
+    selected = NULL;
+    busCycles = 0;
+    accesses = 0;
+    stops = 0;
+    cpuCycles = 0;
+    for (uint8_t i = 0; i < TWI_MODEL_TIMER_COUNT; i++)
+        timerReg[i] = 0;
+    timerCount = 0;
+    timerFlags = 0;
+    timerCycles = 0;
+    timerReg[TWI_MODEL_TIFR1] = TIMER_MODEL_UNTOUCHED;
+    remote.pending = 0;
+    remote.done = 0;
+    twi_model_sreg = 0;
+    for (uint8_t i = 0; i < TWI_MODEL_GPIO_COUNT; i++)
+        gpioReg[i] = 0;
+    sclLow = 0;
+    sdaLow = 0;
+    sdaHeld = 0;
+    sclStuck = 0;
+    startPending = 0;
+    busyUntil = 0;
+    sclHeldUntil = 0;
+    recoveryClocks = 0;
+    gpio_sync();
+    present();
+}
+
+
+/// \brief
+/// Attach a simulated slave to the bus.
+void twi_model_attach(struct TWI_MODEL_SLAVE_type *slave)
+{
+    if (slaveCount < TWI_MODEL_MAX_SLAVES)
+        slaves[slaveCount++] = slave;
+}
+
+
+/// \brief
+/// Inject a fault into the next master operation.
+void twi_model_inject(enum TWI_MODEL_FAULT_type fault_)
+{
+    fault = fault_;
+}
+
+
+/// \brief
+/// A slave keeps SDA low until it has seen `clocks` SCL clocks by the
+/// port pins, for good with `TWI_MODEL_SDA_STUCK`, 0 lets go at once.
+void twi_model_hold_sda(uint8_t clocks)
+{
+    sdaHeld = clocks;
+    gpio_sync();
+}
+
+
+/// \brief
+/// A slave keeps SCL low for `us` from now, whether the TWI is enabled
+/// or not.
+void twi_model_hold_scl(uint32_t us)
+{
+    sclHeldUntil = twi_model_cpu_cycles() + us * (F_CPU / 1000000UL);
+    gpio_sync();
+}
+
+
+/// \brief
+/// Another master holds the bus for `us` from now, clocking SCL at
+/// `F_I2C0_HW`. A START of the TWI waits until it is done.
+void twi_model_bus_busy(uint32_t us)
+{
+    busyUntil = twi_model_cpu_cycles() + us * (F_CPU / 1000000UL);
+}
+
+
+/// \brief
+/// Script a remote master transfer.
+/// \details
+/// For a write access (R/W-flag 0) `length` bytes of `buffer` are sent,
+/// for a read access `length` bytes are read into `buffer`, the last one
+/// answered by 'NACK'. The transfer runs as soon as the bus is free or
+/// wins arbitration against the TWI if a fault is injected.
+void twi_model_remote_master(uint8_t deviceAddress, uint8_t *buffer, uint16_t length)
+{
+    remote.address = deviceAddress;
+    remote.buffer = buffer;
+    remote.length = length;
+    remote.done = 0;
+    remote.pending = ~0;
+}
+
+
+/// \brief
+/// \returns ~0 once the scripted remote master transfer has finished.
+uint8_t twi_model_remote_master_done(void)
+{
+    return(remote.done);
+}
+
+
+/// \brief
+/// Bus cycles (SCL periods) since reset.
+uint32_t twi_model_bus_cycles(void)
+{
+    return(busCycles);
+}
+
+
+/// \brief
+/// Register accesses of the library since reset.
+uint32_t twi_model_register_accesses(void)
+{
+    return(accesses);
+}
+
+
+/// \brief
+/// STOP conditions sent by the TWI or by the port pins since reset.
+uint32_t twi_model_stops(void)
+{
+    return(stops);
+}
+
+
+/// \brief
+/// SCL clocks given by the port pins since reset.
+uint32_t twi_model_recovery_clocks(void)
+{
+    return(recoveryClocks);
+}
+
+
+/// \brief
+/// CPU cycles since reset, see `twi_model.h`.
+uint32_t twi_model_cpu_cycles(void)
+{
+    return(cpuCycles + busCycles * (F_CPU / F_I2C0_HW));
+}
+
+
+static uint8_t register_slave_write(struct TWI_MODEL_SLAVE_type *slave, uint8_t dataByte)
+{
+    struct TWI_MODEL_REGISTER_MAP_type *map = slave->data;
+    if (!map->pointerValid)
+    {
+        map->pointer = dataByte % map->size;
+        map->pointerValid = 1;
+    }
+    else
+    {
+        map->registers[map->pointer] = dataByte;
+        map->pointer = (map->pointer + 1) % map->size;
+    }
+    return(1);
+}
+
+
+static uint8_t register_slave_read(struct TWI_MODEL_SLAVE_type *slave)
+{
+    struct TWI_MODEL_REGISTER_MAP_type *map = slave->data;
+    uint8_t dataByte = map->registers[map->pointer];
+    map->pointer = (map->pointer + 1) % map->size;
+    return(dataByte);
+}
+
+
+static void register_slave_stop(struct TWI_MODEL_SLAVE_type *slave)
+{
+    struct TWI_MODEL_REGISTER_MAP_type *map = slave->data;
+    map->pointerValid = 0;
+}
+
+
+/// \brief
+/// Set up `slave` as a register map (EEPROM / sensor style) slave.
+/// \details
+/// The first byte written sets the register pointer, further bytes are
+/// stored with auto-increment; reads stream out from the pointer.
+void twi_model_register_slave(struct TWI_MODEL_SLAVE_type *slave,
+                              struct TWI_MODEL_REGISTER_MAP_type *map,
+                              uint8_t deviceAddress,
+                              uint8_t *registers,
+                              uint8_t size)
+{
+    map->registers = registers;
+    map->size = size;
+    map->pointer = 0;
+    map->pointerValid = 0;
+    slave->address = deviceAddress & 0xFE;
+    slave->write = register_slave_write;
+    slave->read = register_slave_read;
+    slave->stop = register_slave_stop;
+    slave->data = map;
+}
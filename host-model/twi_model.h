@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi_model.h
+// Description : Behavioral model of the AVR TWI for host builds.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi_model.h
+/// \brief
+/// Behavioral model of the TWI, lets the `twi0_*.c` files run on the host.
+/// \details
+/// The TWI registers are backed by the model. Every access to one of them
+/// first synchronizes the model: a write to TWCR since the last access is
+/// detected and the bus operation it requests is carried out at once,
+/// including TWINT and the TWSR status code. Bus timing is not modeled,
+/// the bus cycles (SCL periods) are counted instead.
+///
+/// Writes to TWCR are recognized by the reserved bit 1: the model reads
+/// it back as '1', the library never writes it. This covers any plain
+/// write, the read-modify-write used to clear TWSTA included.
+///
+/// Slaves on the bus are given by `TWI_MODEL_SLAVE_type` descriptors.
+/// A remote master can be scripted to access the TWI as a slave, and
+/// arbitration loss, bus errors or a stuck SCL can be injected. Another
+/// master can hold the bus for some time, a START waits for it then.
+///
+/// Timer1 is modeled for the timeout of `I2C0_HW_TIMEOUT_TIMER1`: the
+/// counter in normal mode, the prescaler, OCR1B and its compare flag.
+/// It runs on CPU time, which is the bus cycles at `F_CPU / F_I2C0_HW`
+/// each plus `TWI_MODEL_ACCESS_CYCLES` per register access of the
+/// library, about the cost of one turn of a poll loop. TIFR1 reads its
+/// reserved bit 7 as '1' to detect writes, like TWCR.
+///
+/// Port C is modeled for the bus recovery of `I2C0_HW_BUS_RECOVERY`:
+/// SCL (PC5) and SDA (PC4) are low if the port drives them as open
+/// drain, while the TWI is disabled. A slave can be set to keep SDA low
+/// for a number of SCL clocks. `_delay_us()` advances the CPU time.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TWI_MODEL_H_INCLUDED
+#define TWI_MODEL_H_INCLUDED
+
+
+#include <inttypes.h>
+
+
+/// \brief
+/// Index of the TWI registers backed by the model.
+enum TWI_MODEL_REGISTER_type
+{
+    TWI_MODEL_TWBR = 0,
+    TWI_MODEL_TWSR,
+    TWI_MODEL_TWAR,
+    TWI_MODEL_TWDR,
+    TWI_MODEL_TWCR,
+    TWI_MODEL_TWAMR,
+    TWI_MODEL_REGISTER_COUNT
+};
+
+
+/// \brief
+/// Index of the Timer1 registers backed by the model.
+enum TWI_MODEL_TIMER_type
+{
+    TWI_MODEL_TCCR1A = 0,
+    TWI_MODEL_TCCR1B,
+    TWI_MODEL_TCNT1,
+    TWI_MODEL_OCR1B,
+    TWI_MODEL_TIFR1,
+    TWI_MODEL_TIMER_COUNT
+};
+
+
+/// \brief
+/// Index of the port C registers backed by the model.
+enum TWI_MODEL_GPIO_type
+{
+    TWI_MODEL_PORTC = 0,
+    TWI_MODEL_PINC,
+    TWI_MODEL_DDRC,
+    TWI_MODEL_GPIO_COUNT
+};
+
+
+/// \brief
+/// A slave keeping SDA low for good, see `twi_model_hold_sda()`.
+#define TWI_MODEL_SDA_STUCK         0xFF
+
+
+/// \brief
+/// CPU cycles taken by each register access.
+#define TWI_MODEL_ACCESS_CYCLES     3
+
+
+/// \brief
+/// A simulated slave on the bus.
+/// \details
+/// `write` gets each byte sent by the master and returns the 'ACK' (!=0)
+/// or 'NACK' (0). `read` returns the next byte requested by the master.
+/// `stop` is called at STOP or repeated START after the slave has been
+/// addressed, it may be 0.
+struct TWI_MODEL_SLAVE_type
+{
+    uint8_t address;                                            ///< 8 bit address field, R/W-flag 0.
+    uint8_t (*write)(struct TWI_MODEL_SLAVE_type *slave, uint8_t dataByte);
+    uint8_t (*read)(struct TWI_MODEL_SLAVE_type *slave);
+    void (*stop)(struct TWI_MODEL_SLAVE_type *slave);
+    void *data;                                                 ///< Free for the slave implementation.
+};
+
+
+/// \brief
+/// Register map slave, see `twi_model_register_slave()`.
+struct TWI_MODEL_REGISTER_MAP_type
+{
+    uint8_t *registers;
+    uint8_t size;
+    uint8_t pointer;
+    uint8_t pointerValid;
+};
+
+
+/// \brief
+/// Faults to inject into the next master operation.
+enum TWI_MODEL_FAULT_type
+{
+    TWI_MODEL_NO_FAULT = 0,
+    TWI_MODEL_ARBITRATION_LOST,     ///< Next address or data byte loses arbitration.
+    TWI_MODEL_BUS_ERROR,            ///< Next operation reports an illegal START or STOP.
+    TWI_MODEL_SCL_STUCK             ///< A slave keeps SCL low, the next operation never ends until the TWI gets disabled.
+};
+
+
+// Access to a register, used by the host avr/io.h.
+volatile uint8_t *twi_model_register(uint8_t index);
+volatile uint16_t *twi_model_timer(uint8_t index);
+volatile uint8_t *twi_model_gpio(uint8_t index);
+void twi_model_delay_us(uint32_t us);
+
+// Model control.
+void twi_model_reset(void);
+void twi_model_sync(void);
+void twi_model_attach(struct TWI_MODEL_SLAVE_type *slave);
+void twi_model_inject(enum TWI_MODEL_FAULT_type fault);
+void twi_model_hold_sda(uint8_t clocks);
+void twi_model_hold_scl(uint32_t us);
+void twi_model_bus_busy(uint32_t us);
+void twi_model_remote_master(uint8_t deviceAddress, uint8_t *buffer, uint16_t length);
+uint8_t twi_model_remote_master_done(void);
+void twi_model_register_slave(struct TWI_MODEL_SLAVE_type *slave,
+                              struct TWI_MODEL_REGISTER_MAP_type *map,
+                              uint8_t deviceAddress,
+                              uint8_t *registers,
+                              uint8_t size);
+
+// Statistics.
+uint32_t twi_model_bus_cycles(void);
+uint32_t twi_model_register_accesses(void);
+uint32_t twi_model_stops(void);
+uint32_t twi_model_cpu_cycles(void);
+uint32_t twi_model_recovery_clocks(void);
+
+// Host stand-ins of the I/O used by the library.
+extern uint8_t twi_model_sreg;
+extern uint8_t twi_model_gpior0;
+
+
+#endif // TWI_MODEL_H_INCLUDED
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi_speed.c
+// Description : SCL timing of the USI master, compile time and runtime.
+// Author      :
+// Project     : I²C-Lib Host Model
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi_speed.c
+/// \brief
+/// Compares the SCL timing of the USI master with `I2C0_HW_RUNTIME_SPEED`
+/// to the one fixed at compile time, prints one CSV row.
+/// \details
+/// Built per bus frequency `USI_SPEED_RATE` and operation mode by the
+/// Makefile, the lib with `F_I2C0_HW` of 400 kHz, the top speed. The
+/// compile time path of `USI_SPEED_RATE` waits `USI0_LOW_PHASE_CYCLES` and
+/// `USI0_HIGH_PHASE_CYCLES` as `i2c_hw_usi.h` computes them for it, or the
+/// cycles of the bit loop if these are shorter. The runtime path is
+/// calibrated by `usi0_set_speed()` of the lib from
+/// `I2C0_BITRATE_OF(USI_SPEED_RATE)`. At the top speed it runs the compile
+/// time timing of `F_I2C0_HW`, below each phase takes the cycles of
+/// `USI0_LOW_PHASE_LOOP_CYCLES()` and `USI0_HIGH_PHASE_LOOP_CYCLES()`.
+///
+/// Usage: `usi_speed --header` or `usi_speed <opmode>`.
+///
+/// Both paths take the overhead counts of the bit loops and the cycles of
+/// the delay loops from `i2c_hw_usi.h`. So this checks the calibration
+/// against the compile time split, it cannot catch a wrong count. The
+/// instruction timing itself is not simulated, simavr lacks the USI.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#include "i2c_lib_private.h"
+#include <stdio.h>
+#include <string.h>
+
+
+#define MAX(a, b)   (((a) > (b)) ? (a) : (b))
+
+
+// The split of i2c_timing.h for F_I2C0_HW being USI_SPEED_RATE.
+#define RATE_BIT_CYCLES     I2C_BIT_CYCLES(USI_SPEED_RATE)
+#define RATE_LOW_CYCLES     I2C_LOW_PHASE_CYCLES(USI_SPEED_RATE)
+#define RATE_HIGH_CYCLES    I2C_HIGH_PHASE_CYCLES(USI_SPEED_RATE)
+
+
+int main(int argc, char *argv[])
+{
+    unsigned long fixedLow = MAX(RATE_LOW_CYCLES, USI0_LOW_PHASE_OVERHEAD_CYCLES);
+    unsigned long fixedHigh = MAX(RATE_HIGH_CYCLES, USI0_HIGH_PHASE_OVERHEAD_CYCLES);
+    unsigned long runtimeLow, runtimeHigh;
+    double fixedHz, runtimeHz;
+
+    usi0_set_speed(I2C0_BITRATE_OF(USI_SPEED_RATE), I2C0_PRESCALER_OF(USI_SPEED_RATE));
+    if (i2c0_low_phase_loops)
+    {
+        runtimeLow = USI0_LOW_PHASE_LOOP_CYCLES(i2c0_low_phase_loops);
+        runtimeHigh = USI0_HIGH_PHASE_LOOP_CYCLES(i2c0_high_phase_loops);
+    }
+    else
+    {
+        runtimeLow = MAX(USI0_LOW_PHASE_CYCLES, USI0_LOW_PHASE_OVERHEAD_CYCLES);
+        runtimeHigh = MAX(USI0_HIGH_PHASE_CYCLES, USI0_HIGH_PHASE_OVERHEAD_CYCLES);
+    }
+    fixedHz = (double)F_CPU / (fixedLow + fixedHigh);
+    runtimeHz = (double)F_CPU / (runtimeLow + runtimeHigh);
+
+    if ((argc > 1) && !strcmp(argv[1], "--header"))
+    {
+        printf("opmode,f_cpu,f_bus,bitrate,prescaler,"
+               "fixed_low,fixed_high,fixed_hz,runtime_low,runtime_high,runtime_hz,deviation_percent\n");
+        return(0);
+    }
+    printf("%s,%lu,%lu,%u,%u,%lu,%lu,%.0f,%lu,%lu,%.0f,%+.1f\n",
+           (argc > 1) ? argv[1] : "",
+           (unsigned long)F_CPU, (unsigned long)USI_SPEED_RATE,
+           (unsigned)I2C0_BITRATE_OF(USI_SPEED_RATE), (unsigned)I2C0_PRESCALER_OF(USI_SPEED_RATE),
+           fixedLow, fixedHigh, fixedHz, runtimeLow, runtimeHigh, runtimeHz,
+           100.0 * (runtimeHz - fixedHz) / fixedHz);
+    return(0);
+}
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_bus.h
+// Description : One master API for hardware and software emulated buses.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_bus.h
+/// \brief
+/// Include this to write a driver once for any bus master of the lib.
+/// \details
+/// Every master access takes a bus handle, `I2C_BUS_HW0` for the TWI or
+/// USI of `i2c_hw.h`, `I2C_BUS_SW` for the software master of `i2c_sw.h`
+/// and `I2C_BUS_SW1` up to `I2C_BUS_SW4` for the instances of
+/// `i2c_sw_instance.h`.
+///
+/// The access functions are inline and dispatch by a `switch` on the
+/// handle. Given a constant handle the compiler resolves it, a driver
+/// call then compiles into the direct call of the bus function, no
+/// function pointer and no extra cycle. A variable handle selects the
+/// bus by compare and branch.
+///
+/// A constant handle of a bus not configured fails the build, the error
+/// names `i2cBus_notConfigured()`. This takes an optimized build, like
+/// the folding above. A variable handle of such a bus returns
+/// `I2C_PROTOCOL_FAIL` at runtime.
+///
+/// The buses available are told by:
+///  + `I2C0_HW_AS_MASTER`, the hardware master of `i2c_hw.h`.
+///  + `I2C_BUS_WITH_SW`, the single software master of `i2c_sw.h`.
+///  + `I2C_BUS_SW_INSTANCES`, the number of software master instances
+///    (up to 4).
+///
+/// A driver example:
+/// \code
+/// static inline uint8_t sensor_read(enum I2C_BUS_type bus, uint8_t *value)
+/// {
+///     if (!i2cBus_openDevice(bus, SENSOR | I2C_READ_ACCESS))
+///         i2cBus_readBlock(bus, value, 2);
+///     i2cBus_releaseBus(bus);
+///     return(i2cBus_check4Error(bus));
+/// }
+/// \endcode
+/// Declared `static inline` the driver itself is resolved per call site.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_BUS_H_INCLUDED
+#define I2C_BUS_H_INCLUDED
+
+
+#include <inttypes.h>
+#include "i2c_def.h"
+#if defined I2C0_HW_AS_MASTER
+#   include "i2c_hw.h"
+#endif
+#if defined I2C_BUS_WITH_SW
+#   include "i2c_sw.h"
+#endif
+#if defined I2C_BUS_SW_INSTANCES
+#   include "i2c_sw_instance.h"
+#   if I2C_BUS_SW_INSTANCES > 4
+#       error "Up to 4 software master instances are supported by the bus handles. Check your `I2C_BUS_SW_INSTANCES` setting!"
+#   endif
+I2C_SW_DECLARE_INSTANCE(1)
+#   if I2C_BUS_SW_INSTANCES > 1
+I2C_SW_DECLARE_INSTANCE(2)
+#   endif
+#   if I2C_BUS_SW_INSTANCES > 2
+I2C_SW_DECLARE_INSTANCE(3)
+#   endif
+#   if I2C_BUS_SW_INSTANCES > 3
+I2C_SW_DECLARE_INSTANCE(4)
+#   endif
+#else
+#   define I2C_BUS_SW_INSTANCES 0
+#endif
+
+
+/// \brief
+/// Bus handles.
+enum I2C_BUS_type
+{
+    I2C_BUS_HW0 = 0,    ///< Hardware master, TWI or USI.
+    I2C_BUS_SW,         ///< Software master of `i2c_sw.h`.
+    I2C_BUS_SW1,        ///< Software master instance 1.
+    I2C_BUS_SW2,        ///< Software master instance 2.
+    I2C_BUS_SW3,        ///< Software master instance 3.
+    I2C_BUS_SW4         ///< Software master instance 4.
+};
+
+
+/// \brief
+/// Inline for the dispatch to fold away with a constant handle.
+#define I2C_BUS_INLINE      static inline __attribute__((always_inline))
+
+
+/// \brief
+/// Never defined. The dispatch of a constant handle not configured keeps
+/// this call, the compiler rejects it then.
+void i2cBus_notConfigured(void)
+    __attribute__((error("Bus handle of a bus not configured. Check your `I2C0_HW_AS_MASTER`, `I2C_BUS_WITH_SW` and `I2C_BUS_SW_INSTANCES` settings!")));
+
+
+// =============================================================================
+// The cases of one dispatch. `call` is the call without the name prefix,
+// `assign` takes the result (empty for void functions).
+// =============================================================================
+
+#if defined I2C0_HW_AS_MASTER
+#   define I2C_BUS_CASE_HW0(assign, hwCall)  case I2C_BUS_HW0: assign hardI2c0_ ## hwCall; break;
+#else
+#   define I2C_BUS_CASE_HW0(assign, hwCall)
+#endif
+#if defined I2C_BUS_WITH_SW
+#   define I2C_BUS_CASE_SW(assign, call)    case I2C_BUS_SW: assign softI2c_ ## call; break;
+#else
+#   define I2C_BUS_CASE_SW(assign, call)
+#endif
+#if I2C_BUS_SW_INSTANCES > 0
+#   define I2C_BUS_CASE_SW1(assign, call)   case I2C_BUS_SW1: assign softI2c1_ ## call; break;
+#else
+#   define I2C_BUS_CASE_SW1(assign, call)
+#endif
+#if I2C_BUS_SW_INSTANCES > 1
+#   define I2C_BUS_CASE_SW2(assign, call)   case I2C_BUS_SW2: assign softI2c2_ ## call; break;
+#else
+#   define I2C_BUS_CASE_SW2(assign, call)
+#endif
+#if I2C_BUS_SW_INSTANCES > 2
+#   define I2C_BUS_CASE_SW3(assign, call)   case I2C_BUS_SW3: assign softI2c3_ ## call; break;
+#else
+#   define I2C_BUS_CASE_SW3(assign, call)
+#endif
+#if I2C_BUS_SW_INSTANCES > 3
+#   define I2C_BUS_CASE_SW4(assign, call)   case I2C_BUS_SW4: assign softI2c4_ ## call; break;
+#else
+#   define I2C_BUS_CASE_SW4(assign, call)
+#endif
+
+#define I2C_BUS_DISPATCH(bus, assign, hwCall, call)                         \
+    switch (bus)                                                            \
+    {                                                                       \
+        I2C_BUS_CASE_HW0(assign, hwCall)                                    \
+        I2C_BUS_CASE_SW(assign, call)                                       \
+        I2C_BUS_CASE_SW1(assign, call)                                      \
+        I2C_BUS_CASE_SW2(assign, call)                                      \
+        I2C_BUS_CASE_SW3(assign, call)                                      \
+        I2C_BUS_CASE_SW4(assign, call)                                      \
+        default:                                                            \
+            if (__builtin_constant_p(bus))                                  \
+                i2cBus_notConfigured();                                     \
+            break;                                                          \
+    }
+
+
+// =============================================================================
+// The API.
+// =============================================================================
+
+/// \brief
+/// Addresses a certain slave on `bus`, see `hardI2c0_openDevice()`.
+I2C_BUS_INLINE enum I2C_FAILURE_type i2cBus_openDevice(enum I2C_BUS_type bus, uint8_t address)
+{
+    enum I2C_FAILURE_type result = I2C_PROTOCOL_FAIL;
+    I2C_BUS_DISPATCH(bus, result =, openDevice(address), openDevice(address))
+    return(result);
+}
+
+
+/// \brief
+/// Puts one byte to `bus`, see `hardI2c0_putByteAsMaster()`.
+I2C_BUS_INLINE void i2cBus_putByte(enum I2C_BUS_type bus, uint8_t dataByte)
+{
+    I2C_BUS_DISPATCH(bus, , putByteAsMaster(dataByte), putByte(dataByte))
+}
+
+
+/// \brief
+/// Returns one byte read from `bus`, see `hardI2c0_getByteAsMaster()`.
+I2C_BUS_INLINE uint8_t i2cBus_getByte(enum I2C_BUS_type bus, uint8_t sendAck)
+{
+    uint8_t result = 0xFF;
+    I2C_BUS_DISPATCH(bus, result =, getByteAsMaster(sendAck), getByte(sendAck))
+    return(result);
+}
+
+
+/// \brief
+/// Releases `bus`, see `hardI2c0_releaseBus()`.
+I2C_BUS_INLINE void i2cBus_releaseBus(enum I2C_BUS_type bus)
+{
+    I2C_BUS_DISPATCH(bus, , releaseBus(), releaseBus())
+}
+
+
+/// \brief
+/// Failure code(s) of the last access to `bus`, see `hardI2c0_check4Error()`.
+I2C_BUS_INLINE enum I2C_FAILURE_type i2cBus_check4Error(enum I2C_BUS_type bus)
+{
+    enum I2C_FAILURE_type result = I2C_PROTOCOL_FAIL;
+    I2C_BUS_DISPATCH(bus, result =, check4Error(), check4Error())
+    return(result);
+}
+
+
+/// \brief
+/// Puts a block of bytes to `bus`, see `hardI2c0_writeBlock()`.
+I2C_BUS_INLINE enum I2C_FAILURE_type i2cBus_writeBlock(enum I2C_BUS_type bus, const uint8_t *buffer, uint16_t length)
+{
+    enum I2C_FAILURE_type result = I2C_PROTOCOL_FAIL;
+    I2C_BUS_DISPATCH(bus, result =, writeBlock(buffer, length), writeBlock(buffer, length))
+    return(result);
+}
+
+
+/// \brief
+/// Reads a block of bytes from `bus`, see `hardI2c0_readBlock()`.
+I2C_BUS_INLINE enum I2C_FAILURE_type i2cBus_readBlock(enum I2C_BUS_type bus, uint8_t *buffer, uint16_t length)
+{
+    enum I2C_FAILURE_type result = I2C_PROTOCOL_FAIL;
+    I2C_BUS_DISPATCH(bus, result =, readBlock(buffer, length), readBlock(buffer, length))
+    return(result);
+}
+
+
+#endif // I2C_BUS_H_INCLUDED
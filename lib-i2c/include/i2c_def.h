@@ -29,6 +29,9 @@
 #define I2C_DEF_H_INCLUDED
 
 
+#include <inttypes.h>
+
+
 /// \brief
 /// The definition of the read/write access bit state for writing.
 #define I2C_WRITE_ACCESS      0
@@ -82,4 +85,17 @@ enum I2C_FAILURE_type
     I2C_RESTARTED = 1 << 7          ///< 'START' detected during transfer.
 };
 
+
+/// \brief
+/// Status record of one transaction.
+/// \details
+/// Owned by the application, updated in place by the engine while the
+/// transaction runs. Each transaction may have a record of its own, so
+/// the outcome of one does not overwrite the outcome of another.
+struct I2C_STATUS_type
+{
+    volatile enum I2C_FAILURE_type failure; ///< Failure code(s) of the transaction.
+    volatile uint8_t pending;               ///< !=0 while the transaction runs.
+};
+
 #endif // I2C_DEF_H_INCLUDED
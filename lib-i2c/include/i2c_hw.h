@@ -17,6 +17,30 @@
 //               To further improve code size the flag
 //                  I2C0_HW_SINGLE_MASTER
 //               can be set to rule out multi master related parts.
+//               The flag
+//                  I2C0_HW_INTERRUPT_DRIVEN
+//               selects the interrupt driven engine where available.
+//               On USI micros a single master can have SCL clocked by Timer0:
+//                  I2C0_HW_TIMER0_CLOCKED
+//               The byte primitives get inline (header only) by the flag
+//                  I2C0_HW_INLINE_PRIMITIVES
+//               The failure codes move from RAM to an I/O register by
+//                  I2C0_HW_FAILURE_REG
+//               Multi master modes retry after a lost arbitration as set by
+//                  I2C0_HW_RETRY_ATTEMPTS, I2C0_HW_BACKOFF_SEED,
+//                  I2C0_HW_BACKOFF_WINDOW, I2C0_HW_BACKOFF_SLOT_us
+//               The interrupt driven TWI master queues transactions by
+//                  I2C0_HW_QUEUE_SIZE
+//               and links them by repeated START with
+//                  I2C0_HW_CHAIN_TRANSACTIONS
+//               The blocking TWI masters switch the bus speed per slave by
+//                  I2C0_HW_SPEED_SLAVES
+//               The USI masters take the bus speed at runtime with
+//                  I2C0_HW_RUNTIME_SPEED
+//               The blocking TWI modes bound each wait by Timer1 with
+//                  I2C0_HW_TIMEOUT_TIMER1
+//               The blocking masters clock out a slave keeping SDA low by
+//                  I2C0_HW_BUS_RECOVERY
 // Author      : R. Trapp
 // Project     : I²C-Lib
 // Initial date: Aug /  2 / 2012
@@ -99,6 +123,121 @@
 ///  + `I2C0_HW_AS_SLAVE`
 ///  + `I2C0_HW_AS_MASTER`
 ///  + `I2C0_HW_SINGLE_MASTER`
+///  + `I2C0_HW_INTERRUPT_DRIVEN`
+///  + `I2C0_HW_TIMER0_CLOCKED`
+///
+/// `I2C0_HW_INTERRUPT_DRIVEN` adds an interrupt driven engine to the selected
+/// mode. The application then submits a complete transaction and is free to
+/// continue its work while the hardware interrupt moves the bytes.
+/// The TWI supports this for any master mode without slave response.
+/// Both, TWI and USI, support this for the slave without master mode: the
+/// interrupts move the bytes from and to buffers or a register file
+/// assigned by the application.
+/// Do not forget to enable interrupts globally (`sei()`) when using it.
+///
+/// In the multi master modes `hardI2c0_openDeviceRetry()` takes the retry
+/// loop after a lost arbitration off the application. It backs off for a
+/// random time before each new attempt, serves this device's slave part
+/// meanwhile and gives up after `I2C0_HW_RETRY_ATTEMPTS` attempts. Give
+/// each master of the bus its own `I2C0_HW_BACKOFF_SEED`, e.g. its slave
+/// address, else they back off in step.
+///
+/// `I2C0_HW_QUEUE_SIZE` gives the interrupt driven TWI master a queue of
+/// this many transaction slots, a power of 2, e.g.
+/// `-DI2C0_HW_QUEUE_SIZE=8`. Up to `I2C0_HW_QUEUE_SIZE - 1` transactions,
+/// the running one included, are accepted by `hardI2c0_submitTransaction()`
+/// then. The interrupt runs them back to back without returning to the
+/// application in between.
+///
+/// `I2C0_HW_CHAIN_TRANSACTIONS` links the queued transactions by a
+/// repeated 'START' instead of 'STOP' and 'START'. The bus stays claimed
+/// from the first transaction to the last one queued, only then the
+/// 'STOP' is sent. This saves the bus free time between the transactions
+/// and keeps other masters off the bus. Queue the transactions to poll
+/// in a row, the chain ends as soon as the queue runs empty.
+///
+/// `I2C0_HW_SPEED_SLAVES` lets the blocking TWI masters run each slave at
+/// a speed of its own, e.g. `-DI2C0_HW_SPEED_SLAVES=4` for up to 4 slaves.
+/// `hardI2c0_setSlaveSpeed()` assigns one of the profiles
+/// `I2C0_SPEED_100k`, `I2C0_SPEED_400k` and `I2C0_SPEED_1M` to a slave,
+/// `hardI2c0_openDevice()` switches TWBR and the prescaler before the
+/// 'START'. Slaves without a profile run at `F_I2C0_HW`, which is
+/// `I2C0_SPEED_DEFAULT`. The bit rate and prescaler of each profile are
+/// computed at compile time like `I2C0_BITRATE` and `I2C0_PRESCALER`. A
+/// profile needing a TWBR below 10 is not defined, e.g. `I2C0_SPEED_400k`
+/// requires F_CPU of 14.4 MHz and up, `I2C0_SPEED_1M` 36 MHz.
+///
+/// `I2C0_HW_RUNTIME_SPEED` lets the USI masters, but the Timer0 clocked
+/// one, take `bitrate` and `prescaler` of `hardI2c0_init()` like the
+/// TWI does, instead of the bus speed fixed by `F_I2C0_HW`. The SCL
+/// phases are timed by delay loops then, calibrated by the init and by
+/// `hardI2c0_setBusSpeed()`. The same firmware may address fast devices
+/// at 400 kHz and fall back to 100 kHz for slow ones. `F_I2C0_HW` is the
+/// top speed: at its bit time or a shorter one the bit loops keep their
+/// compile time timing, as without `I2C0_HW_RUNTIME_SPEED`. Slower speeds
+/// wait by an 8 bit loop in the low phase and a 16 bit one in the high
+/// phase, together they hit the bit time within a cycle or two. The
+/// byte loops pick the timing once per byte, so the bit time holds no
+/// test of it; the price is the code of the byte loops twice. See
+/// `make usi-speed` of the host model for the speeds achieved, computed
+/// from the cycle counts of `i2c_hw_usi.h`.
+///
+/// `I2C0_HW_TIMEOUT_TIMER1` bounds each wait of the blocking TWI modes
+/// for the TWI to finish a bus operation by `I2C0_HW_EMERGENCY_TIMEOUT_us`.
+/// A slave keeping SCL low then no longer hangs the application; the
+/// call returns with `I2C_TIMED_OUT` and the TWI is reset. The init
+/// starts Timer1 running free, at the smallest prescaler that spans the
+/// timeout. Each wait sets OCR1B ahead of the counter, the poll loop
+/// tests the compare flag by a single `sbis` (`in` and `sbrc` on the
+/// ATmega8), 2 or 3 cycles more per turn.
+/// The 'START' of a multi master waits as long as another master holds
+/// the bus, there the timeout counts only while SCL stays low.
+/// The timeout is up one Timer1 tick late at most. Timer1 is shared:
+/// the application may read TCNT1 and use OCR1A, but must not change
+/// the mode or the clock of the timer, and must not use OCR1B.
+///
+/// `I2C0_HW_BUS_RECOVERY` frees the bus from a slave that keeps SDA
+/// low, e.g. after the master got reset within a read. The blocking
+/// masters then take the pins as port pins, clock SCL up to 9 times
+/// until SDA is released, send a 'STOP' and hand the pins back to the
+/// TWI or USI, see `hardI2c0_recoverBus()`. The single masters do so
+/// on their own if they find SDA low at the init or before a 'START',
+/// the TWI single master with `I2C0_HW_TIMEOUT_TIMER1` on a timeout as
+/// well, unless a slave still keeps SCL low. The multi masters leave it
+/// to the application: the clocks would disturb the transfer of another
+/// master, on a busy bus neither SDA low nor a timeout tells a stuck
+/// slave for sure. The software master of `i2c_sw.h` does the same by
+/// `I2C_SW_BUS_RECOVERY`.
+///
+/// `I2C0_HW_TIMER0_CLOCKED` is dedicated to the USI single master. The SCL
+/// edges are generated by the Timer0 compare interrupt and the bytes are
+/// completed by the USI counter overflow interrupt. Thus the CPU is free
+/// while a byte is transferred; `hardI2c0_putByteAsMaster()` returns before
+/// the byte is on the bus, the next call to the library waits for it.
+/// Timer0 is occupied by the library then.
+/// Again interrupts need to be enabled globally (`sei()`).
+///
+/// `I2C0_HW_INLINE_PRIMITIVES` makes the byte primitives of the TWI and
+/// the bit and byte primitives of the USI masters clocked by software
+/// inline, e.g. `hardI2c0_putByteAsMaster()`, `hardI2c0_getByteAsMaster()`,
+/// `hardI2c0_releaseBus()` and `hardI2c0_check4Error()`. Their
+/// bodies are in `i2c_hw_twi_primitives.h` and `i2c_hw_usi_primitives.h`,
+/// the lib and the application call them without subroutine call. This
+/// saves cycles per byte and may cost flash, the more call sites the more.
+/// Set it alike for the lib and the application. Only then the
+/// application sees these bodies, `<avr/io.h>` and the failure code they
+/// use.
+///
+/// `I2C0_HW_FAILURE_REG` names an I/O register to keep the failure codes
+/// of `I2C_FAILURE_type` in, instead of a RAM byte, e.g.
+/// `-DI2C0_HW_FAILURE_REG=GPIOR0`. In the lower 32 I/O addresses, where
+/// GPIOR0 of ATmega48/88/168/328 and ATtiny2313 is, setting or testing a
+/// flag is a single `sbi`, `cbi` or `sbis` instruction. The register is
+/// occupied by the library then. Set it alike for the lib and the
+/// application.
+///
+/// The variables of the library are defined in `i2c0_hw_state.c`, add it to
+/// the project together with the other files of the lib.
 ///
 /// Using any master operation mode requires some further prerequisites to
 /// adjust its properties. If any of the following definitions is omitted a
@@ -382,7 +521,8 @@
 /// \note
 /// Please be aware that setting the bitrate on the fly is only possible when TWI
 /// hardware support is used. Using USI the bitrate is hardcoded when the lib is
-/// build and thus fixed when running the bus.
+/// build and thus fixed when running the bus, unless `I2C0_HW_RUNTIME_SPEED`
+/// is defined.
 /// \todo
 /// bitrate and prescaler eventually should get omitted completely
 /// from the init. USI does not support it at all.
@@ -532,6 +672,366 @@ enum I2C_FAILURE_type hardI2c0_openDevice(uint8_t deviceAddress);
 /// \sa hardI2c0_openDevice()
 void hardI2c0_releaseBus(void);
 
+
+/// \brief
+/// Puts a block of bytes to the bus. Returns access status.
+/// Dedicated to any master mode usage.
+/// \details
+/// `length` bytes of `buffer` are sent to the already addressed slave
+/// within one loop.
+/// This saves the call and the status check per byte of an equivalent
+/// loop of `hardI2c0_putByteAsMaster()` in the application.
+/// The USI masters clocked by software run the shift register and the
+/// bit loop of each byte inline and choose the bus timing once per
+/// block, the TWI and the Timer0 clocked USI master loop over the byte
+/// functions.
+/// The transfer stops at the first byte not acknowledged by the slave or
+/// at any other failure.
+/// \code
+/// uint8_t page[] = {0x00, 0x10, 'H', 'e', 'l', 'l', 'o'};
+/// if (!hardI2c0_openDevice(I2C_EEPROM | I2C_WRITE_ACCESS))
+///     hardI2c0_writeBlock(page, sizeof(page));
+/// hardI2c0_releaseBus();
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_MASTER`
+/// indicates any master mode usage.
+/// \param buffer holds the bytes to send.
+/// \param length number of bytes to send, 16 bit like with the
+/// software master.
+/// \returns Status of the transfer.
+/// \sa hardI2c0_openDevice()
+/// \sa hardI2c0_readBlock()
+enum I2C_FAILURE_type hardI2c0_writeBlock(const uint8_t *buffer, uint16_t length);
+
+
+/// \brief
+/// Reads a block of bytes from the bus. Returns access status.
+/// Dedicated to any master mode usage.
+/// \details
+/// `length` bytes are read from the already addressed slave into `buffer`
+/// within one loop.
+/// All bytes but the last one are answered by an 'ACK', the last one by
+/// a 'NACK' as the bus protocol requires.
+/// The USI masters clocked by software run the byte body inline, once
+/// with the 'ACK' and once with the 'NACK' of the last byte, so there is
+/// no reply to decide per byte.
+/// The transfer stops at any failure.
+/// \note This function is only available when `I2C0_HW_AS_MASTER`
+/// indicates any master mode usage.
+/// \param buffer receives the bytes read.
+/// \param length number of bytes to read, 16 bit like with the
+/// software master.
+/// \returns Status of the transfer.
+/// \sa hardI2c0_openDevice()
+/// \sa hardI2c0_writeBlock()
+enum I2C_FAILURE_type hardI2c0_readBlock(uint8_t *buffer, uint16_t length);
+
+
+/// \brief
+/// Writes to a slave and reads back from it within one bus access.
+/// Returns access status.
+/// Dedicated to any master mode usage.
+/// \details
+/// This is the typical register access of most sensors: the register
+/// pointer is written, a repeated 'START' turns the access around and
+/// the register contents are read.
+/// The slave gets addressed for writing and `writeCount` bytes are sent.
+/// The repeated 'START' follows the last byte written without any detour
+/// through the application. The single master TWI asserts it right
+/// after the last byte, the other modes call `hardI2c0_openDevice()` for
+/// it: there this function is a convenience wrapper, it saves code in
+/// the application but no bus time. `readCount` bytes are read, the last one
+/// answered by 'NACK', and the bus is released by a 'STOP'.
+/// If the arbitration gets lost the bus is not released since it is
+/// owned by the other master then.
+/// A code example might be like this:
+/// \code
+/// uint8_t reg = 0x10;
+/// uint8_t data[2];
+/// if (!hardI2c0_writeRead(I2C_EEPROM, &reg, 1, data, 2))
+///     ... // data[] is valid now
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_MASTER`
+/// indicates any master mode usage.
+/// \param deviceAddress of the desired slave. The R/W-flag is ignored.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send. If 0 the slave is
+/// addressed for reading right away.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read. If 0 there is no read part.
+/// \returns Status of access.
+/// \sa hardI2c0_writeBlock()
+/// \sa hardI2c0_readBlock()
+enum I2C_FAILURE_type hardI2c0_writeRead(uint8_t deviceAddress,
+                                         const uint8_t *writeBuffer,
+                                         uint16_t writeCount,
+                                         uint8_t *readBuffer,
+                                         uint16_t readCount);
+
+#endif
+
+
+// Dedicated to multi master mode:
+// -------------------------------
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Addresses a certain slave, retries after a lost arbitration.
+/// Returns access status.
+/// Dedicated to multi master mode usage.
+/// \details
+/// Works like `hardI2c0_openDevice()` but does not return on a lost
+/// arbitration (`I2C_ARBITRATION_LOST`, `I2C_RESTARTED`) right away.
+/// The master backs off and tries again, up to `I2C0_HW_RETRY_ATTEMPTS`
+/// times in total. The backoff lasts a random number of slots of
+/// `I2C0_HW_BACKOFF_SLOT_us`, taken from a window of 1 slot at the first
+/// loss, doubled with each further loss up to `I2C0_HW_BACKOFF_WINDOW`.
+/// Masters with different `I2C0_HW_BACKOFF_SEED` draw different random
+/// numbers, so they don't collide again and again.
+///
+/// If this device is a slave as well the arbitration may get lost to a
+/// master addressing it. `serveSlave` is called once per slot to handle
+/// this access, typically checking `hardI2c0_isAddressedAsSlave()` and
+/// moving the bytes. Pass 0 if there is no slave part.
+/// A code example might be like this:
+/// \code
+/// if (!hardI2c0_openDeviceRetry(I2C_EEPROM | I2C_WRITE_ACCESS, do_the_slave_activities))
+///     hardI2c0_writeBlock(data, sizeof(data));
+/// if (!(hardI2c0_check4Error() & I2C_ARBITRATION_LOST))
+///     hardI2c0_releaseBus();
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_MASTER` is
+/// defined but `I2C0_HW_SINGLE_MASTER` is not.
+/// \param deviceAddress of the desired slave. It shall define the
+/// READ or WRITE mode also.
+/// \param serveSlave handles a pending slave access, may be 0.
+/// \returns Status of the last attempt. Still `I2C_ARBITRATION_LOST` if
+/// all attempts got lost.
+/// \sa hardI2c0_openDevice()
+enum I2C_FAILURE_type hardI2c0_openDeviceRetry(uint8_t deviceAddress, void (*serveSlave)(void));
+
+#endif
+
+
+// Dedicated to USI master modes with runtime bus speed:
+// -----------------------------------------------------
+
+#if defined I2C0_HW_RUNTIME_SPEED || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Changes the bus frequency of the USI master.
+/// Dedicated to the USI master modes but the Timer0 clocked one.
+/// \details
+/// Takes effect with the next SCL phase, call it between transactions.
+/// `bitrate` and `prescaler` give the bit time like with the TWI, thus
+/// the same values fit both:
+/// \code
+/// hardI2c0_setBusSpeed(I2C0_BITRATE_OF(400000UL), I2C0_PRESCALER_OF(400000UL));
+/// if (!hardI2c0_openDevice(I2C_EEPROM | I2C_WRITE_ACCESS))
+///     hardI2c0_writeBlock(data, sizeof(data));
+/// hardI2c0_releaseBus();
+/// hardI2c0_setBusSpeed(I2C0_BITRATE, I2C0_PRESCALER);    // F_I2C0_HW
+/// \endcode
+/// \note This function is only available when `I2C0_HW_RUNTIME_SPEED` is
+/// defined on a USI micro.
+/// \param bitrate see `I2C0_BITRATE_OF()`.
+/// \param prescaler see `I2C0_PRESCALER_OF()`.
+void hardI2c0_setBusSpeed(uint8_t bitrate, uint8_t prescaler);
+
+#endif
+
+
+// Dedicated to master modes with bus recovery:
+// ---------------------------------------------
+
+#if defined I2C0_HW_BUS_RECOVERY || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Frees the bus from a slave keeping SDA low. Returns its status.
+/// Dedicated to the blocking master modes but the Timer0 clocked one.
+/// \details
+/// A slave reset or disturbed within a byte keeps on driving its bit
+/// to SDA, waiting for the clock. SCL is clocked up to 9 times in
+/// standard mode until the slave releases SDA, then the 'STOP' is sent.
+/// The slave sees a 'NACK' at the end of its byte and is idle again.
+/// The bus is back within about 120 us. A slave keeping SCL low ends
+/// the recovery after `I2C0_HW_EMERGENCY_TIMEOUT_us`.
+///
+/// The single master modes call it on their own, see the mainpage. A
+/// multi master calls it only if it is sure no other master is active,
+/// e.g. after a reset the application knows to hit it within a transfer:
+/// \code
+/// hardI2c0_init(SLAVE_ADDRESS, SLAVE_ADDRESS_MASK, I2C0_BITRATE, I2C0_PRESCALER);
+/// if (MCUSR & (1 << WDRF))
+///     hardI2c0_recoverBus();
+/// \endcode
+/// \note This function is only available when `I2C0_HW_BUS_RECOVERY` is
+/// defined.
+/// \returns `I2C_SUCCESS` if the bus is free again, `I2C_SDA_BLOCKED`
+/// if the slave keeps SDA low, `I2C_TIMED_OUT` if SCL is kept low.
+enum I2C_FAILURE_type hardI2c0_recoverBus(void);
+
+#endif
+
+
+// Dedicated to master modes with speed profiles:
+// ----------------------------------------------
+
+#if defined I2C0_HW_SPEED_SLAVES || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Assigns a bus speed profile to a slave.
+/// Dedicated to the blocking TWI master modes.
+/// \details
+/// From now on `hardI2c0_openDevice()` switches the bus to this speed
+/// before it addresses the slave, and back to the speed of the next
+/// slave addressed. Up to `I2C0_HW_SPEED_SLAVES` slaves get a profile,
+/// all others run at `I2C0_SPEED_DEFAULT`, the speed of `F_I2C0_HW`.
+/// The switch takes place between transactions, when the bus master
+/// is idle. A repeated START to a slave of another profile switches as
+/// well.
+/// A code example might be like this:
+/// \code
+/// hardI2c0_init(dummy, dummy, I2C0_BITRATE, I2C0_PRESCALER);
+/// hardI2c0_setSlaveSpeed(I2C_EEPROM, I2C0_SPEED_400k);
+/// ...
+/// if (!hardI2c0_openDevice(I2C_EEPROM | I2C_WRITE_ACCESS))   // 400 kHz
+///     hardI2c0_writeBlock(data, sizeof(data));
+/// hardI2c0_releaseBus();
+/// if (!hardI2c0_openDevice(I2C_LEGACY | I2C_READ_ACCESS))    // F_I2C0_HW
+///     hardI2c0_readBlock(data, sizeof(data));
+/// hardI2c0_releaseBus();
+/// \endcode
+/// \note This function is only available when `I2C0_HW_SPEED_SLAVES` is
+/// defined, for the TWI without `I2C0_HW_INTERRUPT_DRIVEN`.
+/// \param deviceAddress of the slave, the R/W-flag is ignored.
+/// \param profile `I2C0_SPEED_DEFAULT`, `I2C0_SPEED_100k`,
+/// `I2C0_SPEED_400k` or `I2C0_SPEED_1M`, those F_CPU allows only.
+/// \returns 0 if there is no entry left for the slave, ~0 else.
+uint8_t hardI2c0_setSlaveSpeed(uint8_t deviceAddress, uint8_t profile);
+
+#endif
+
+
+// Dedicated to interrupt driven master mode:
+// ------------------------------------------
+
+#if defined I2C0_HW_AS_MASTER && defined I2C0_HW_INTERRUPT_DRIVEN || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Submits a complete transaction to the interrupt driven master.
+/// Returns immediately.
+/// \details
+/// The transaction is given by the slave address and a write and a read
+/// part, each of them optional.
+/// A 'START' followed by the address field is asserted to the bus.
+/// If `writeCount` is not zero the bytes of `writeBuffer` are sent next.
+/// If `readCount` is not zero a repeated 'START' switches to read access
+/// (or the first 'START' already addresses for read if there is nothing to
+/// write) and `readCount` bytes are stored to `readBuffer`.
+/// The last byte read is answered by 'NACK'.
+/// Finally the bus is released by a 'STOP'.
+///
+/// The buffers are used by the interrupt while the transaction runs, so the
+/// application must not touch them before `hardI2c0_isBusy()` returns 0.
+/// The failure code(s) of the transaction can be checked by calling
+/// `hardI2c0_check4Error()` afterwards.
+/// A code example might be like this:
+/// \code
+/// uint8_t reg = 0x10;
+/// uint8_t data[2];
+/// hardI2c0_startTransaction(I2C_EEPROM, &reg, 1, data, 2);
+/// ... // do some other work
+/// while (hardI2c0_isBusy()) {}
+/// if (!hardI2c0_check4Error())
+///     ... // data[] is valid now
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_MASTER` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_SLAVE` is not.
+/// \param deviceAddress of the desired slave. The R/W-flag is ignored.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send, may be 0.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read, may be 0.
+/// \returns Acceptance: 0 if still busy with the previous transaction
+/// (nothing submitted), !=0 if accepted. With `I2C0_HW_QUEUE_SIZE` 0 as
+/// well while the previous transaction submitted by this function is
+/// pending in the queue, or if the queue is full.
+/// \sa hardI2c0_isBusy()
+/// \sa hardI2c0_check4Error()
+uint8_t hardI2c0_startTransaction(uint8_t deviceAddress,
+                                  uint8_t *writeBuffer,
+                                  uint16_t writeCount,
+                                  uint8_t *readBuffer,
+                                  uint16_t readCount);
+
+
+/// \brief
+/// Submits a complete transaction to the interrupt driven master, the
+/// outcome goes to a status record of the caller.
+/// Returns immediately.
+/// \details
+/// Same as `hardI2c0_startTransaction()`, but the interrupt reports to
+/// `status` in place: `status->failure` collects the failure code(s) as
+/// they occur, `status->pending` is cleared when the transaction is
+/// done. Each transaction may have a record of its own, the outcome of a
+/// transaction is not lost by starting the next one or by another part
+/// of the application checking its own.
+///
+/// `hardI2c0_check4Error()` reports the last transaction finished, no
+/// matter which way it was submitted.
+///
+/// With `I2C0_HW_QUEUE_SIZE` set the transaction is queued behind the ones
+/// still running, 0 is returned if the queue is full only. When one
+/// transaction is done the interrupt asserts the 'STOP' and the 'START'
+/// of the next one at once, with `I2C0_HW_CHAIN_TRANSACTIONS` just the
+/// repeated 'START'. `hardI2c0_startTransaction()` queues as well, but
+/// only one transaction at a time: all of them report to one internal
+/// record, so it returns 0 while its previous one is pending.
+/// `hardI2c0_isBusy()` indicates the queue is not run empty yet.
+/// A code example might be like this:
+/// \code
+/// static struct I2C_STATUS_type sensorStatus;
+/// uint8_t reg = 0x10;
+/// uint8_t data[2];
+/// hardI2c0_submitTransaction(I2C_SENSOR, &reg, 1, data, 2, &sensorStatus);
+/// ... // do some other work
+/// if (!sensorStatus.pending && !sensorStatus.failure)
+///     ... // data[] is valid now
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_MASTER` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_SLAVE` is not.
+/// \param deviceAddress of the desired slave. The R/W-flag is ignored.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send, may be 0.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read, may be 0.
+/// \param status receives the outcome, must stay valid until
+/// `status->pending` is 0.
+/// \returns Acceptance: 0 if still busy with the previous transaction
+/// or the queue is full (nothing submitted, `status` untouched), !=0 if
+/// accepted.
+/// \sa hardI2c0_startTransaction()
+uint8_t hardI2c0_submitTransaction(uint8_t deviceAddress,
+                                   uint8_t *writeBuffer,
+                                   uint16_t writeCount,
+                                   uint8_t *readBuffer,
+                                   uint16_t readCount,
+                                   struct I2C_STATUS_type *status);
+
+
+/// \brief
+/// Indicates a running transaction.
+/// Dedicated to interrupt driven master mode usage.
+/// \details
+/// Polls the state of a transaction submitted by `hardI2c0_startTransaction()`.
+/// \note This function is only available when `I2C0_HW_AS_MASTER` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_SLAVE` is not.
+/// \returns Transaction state: 0 if done, !=0 if still running.
+/// \sa hardI2c0_startTransaction()
+uint8_t hardI2c0_isBusy(void);
+
 #endif
 
 
@@ -673,6 +1173,100 @@ void hardI2c0_setSlaveResponse(uint8_t on);
 #endif
 
 
+// Dedicated to interrupt driven slave mode:
+// -----------------------------------------
+
+#if defined I2C0_HW_AS_SLAVE && defined I2C0_HW_INTERRUPT_DRIVEN || defined DOXYGEN_DOCU_IS_GENERATED
+
+/// \brief
+/// Assigns the buffers used by the interrupt driven slave.
+/// \details
+/// Every transfer starts at the beginning of the buffers. Bytes written by
+/// a master are stored to `rxBuffer`, the byte exceeding `rxSize` is
+/// answered by 'NACK'. Bytes read by a master are taken from `txBuffer`,
+/// 0xFF is returned beyond `txSize`.
+/// Until the buffers are assigned the slave answers its address only.
+/// Replaces a register file assigned by `hardI2c0_setSlaveRegisterFile()`.
+/// \note This function is only available when `I2C0_HW_AS_SLAVE` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_MASTER` is not.
+/// \param rxBuffer receives the bytes written by a master.
+/// \param rxSize size of `rxBuffer`.
+/// \param txBuffer holds the bytes read by a master.
+/// \param txSize size of `txBuffer`.
+/// \sa hardI2c0_slaveTransferDone()
+void hardI2c0_setSlaveBuffers(uint8_t *rxBuffer, uint8_t rxSize,
+                              uint8_t *txBuffer, uint8_t txSize);
+
+
+/// \brief
+/// Indicates a transfer finished by the interrupt driven slave.
+/// \details
+/// Reports each finished transfer once, the latest one only if the
+/// application polls too slowly. The 'STOP' ending a transfer raises no
+/// interrupt, so it is recognized by this function.
+/// A code example might be like this:
+/// \code
+/// uint8_t command[4], reply[4];
+/// uint8_t address, count;
+/// hardI2c0_init(0xA0, 0x00, 0, 0);
+/// hardI2c0_setSlaveBuffers(command, sizeof(command), reply, sizeof(reply));
+/// sei();
+/// while (...)
+/// {
+///     if (hardI2c0_slaveTransferDone(&address, &count))
+///     {
+///         if (!(address & I2C_READ_ACCESS))
+///             ... // count bytes received in command[]
+///     }
+///     ... // do some other work
+/// }
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_SLAVE` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_MASTER` is not.
+/// \param addressReceived contains the address field sent by the master,
+/// including the R/W-flag.
+/// \param byteCount contains the number of bytes moved.
+/// \returns Transfer state: 0 if nothing finished, !=0 if finished.
+/// \sa hardI2c0_setSlaveBuffers()
+uint8_t hardI2c0_slaveTransferDone(uint8_t *addressReceived, uint8_t *byteCount);
+
+
+/// \brief
+/// Assigns a register file to the interrupt driven slave.
+/// \details
+/// The slave then behaves like a sensor style register map. The first byte
+/// of a write access sets the register pointer, any further bytes are
+/// stored to the registers with auto-increment. A read access streams out
+/// the registers from the pointer on. The pointer wraps around at `size`
+/// and is kept between transfers. All of this is done by the interrupts,
+/// the application is not involved per byte.
+/// A code example might be like this:
+/// \code
+/// uint8_t registers[8];
+/// uint8_t address, count;
+/// hardI2c0_init(0xA0, 0x00, 0, 0);
+/// hardI2c0_setSlaveRegisterFile(registers, sizeof(registers));
+/// sei();
+/// while (...)
+/// {
+///     if (hardI2c0_slaveTransferDone(&address, &count) && (count > 1))
+///         ... // registers written by the master
+///     ... // do some other work
+/// }
+/// \endcode
+/// \note This function is only available when `I2C0_HW_AS_SLAVE` and
+/// `I2C0_HW_INTERRUPT_DRIVEN` are defined but `I2C0_HW_AS_MASTER` is not.
+/// \param registers RAM array serving as register file.
+/// \param size number of registers, at least 1. A `size` of 0 or no
+/// `registers` are rejected and leave the slave as it is.
+/// \returns 0 if rejected, else !=0.
+/// \sa hardI2c0_setSlaveBuffers()
+/// \sa hardI2c0_slaveTransferDone()
+uint8_t hardI2c0_setSlaveRegisterFile(uint8_t *registers, uint8_t size);
+
+#endif
+
+
 // =============================================================================
 // Check for bus frequency definition.
 // =============================================================================
@@ -684,6 +1278,7 @@ void hardI2c0_setSlaveResponse(uint8_t on);
 /// synchronize the master to its slower speed.
 ///
 /// A timeout is implemented to avoid hangups if the bus is disrupted or blocked.
+/// The TWI modes take it into account with `I2C0_HW_TIMEOUT_TIMER1` only.
 /// If your application calls for another setting simply override this
 /// definition by applying your own definition line before invocation of this
 /// header.
@@ -732,6 +1327,71 @@ void hardI2c0_setSlaveResponse(uint8_t on);
 #endif
 
 
+/// \brief
+/// Bit rate and prescaler of the bus frequency `f`.
+/// \details
+/// `I2C0_BITRATE_OF(f)` and `I2C0_PRESCALER_OF(f)` are the `bitrate` and
+/// `prescaler` of `hardI2c0_init()` for a bus frequency of `f` Hz. The
+/// SCL frequency results in F_CPU / (16 + 2 * bitrate * 4^prescaler),
+/// the formula of the TWI. `I2C0_DIVISOR(f)` is the divisor before
+/// prescaling, 2 * bitrate * 4^prescaler.
+///
+/// Example:
+/// \code
+/// hardI2c0_init(dummy, dummy, I2C0_BITRATE_OF(400000UL), I2C0_PRESCALER_OF(400000UL));
+/// \endcode
+#define I2C0_DIVISOR(f)         (((F_CPU/(f)) < 16) ? 0 : (((F_CPU/(f))-16)/2))
+#define I2C0_BITRATE_OF(f)      ((I2C0_DIVISOR(f) < 256)   ? I2C0_DIVISOR(f)      : \
+                                 (I2C0_DIVISOR(f) < 1021)  ? I2C0_DIVISOR(f) / 4  : \
+                                 (I2C0_DIVISOR(f) < 4081)  ? I2C0_DIVISOR(f) / 16 : \
+                                 (I2C0_DIVISOR(f) < 16321) ? I2C0_DIVISOR(f) / 64 : 0xFF)
+#define I2C0_PRESCALER_OF(f)    ((I2C0_DIVISOR(f) < 256)   ? 0x00 : \
+                                 (I2C0_DIVISOR(f) < 1021)  ? 0x01 : \
+                                 (I2C0_DIVISOR(f) < 4081)  ? 0x02 : 0x03)
+
+
+/// \brief
+/// Retry after a lost arbitration, see `hardI2c0_openDeviceRetry()`.
+/// \details
+/// Attempts to address the slave in total, default 8.
+///
+/// The backoff is made of slots of `I2C0_HW_BACKOFF_SLOT_us`, default
+/// one byte on the bus (9 SCL periods). The window of slots to draw
+/// from doubles with each attempt up to `I2C0_HW_BACKOFF_WINDOW`, a
+/// power of 2 up to 128, default 16.
+///
+/// `I2C0_HW_BACKOFF_SEED` starts the random numbers, 1 to 255. Give each
+/// master on the bus its own, e.g. its slave address.
+///
+/// Example:
+/// \code
+/// define I2C0_HW_BACKOFF_SEED    0x42
+///
+/// #include "i2c_hw.h"
+/// \endcode
+#if !defined I2C0_HW_RETRY_ATTEMPTS || defined DOXYGEN_DOCU_IS_GENERATED
+#   define I2C0_HW_RETRY_ATTEMPTS 8
+#endif
+#if !defined I2C0_HW_BACKOFF_WINDOW || defined DOXYGEN_DOCU_IS_GENERATED
+#   define I2C0_HW_BACKOFF_WINDOW 16
+#endif
+#if !defined I2C0_HW_BACKOFF_SLOT_us || defined DOXYGEN_DOCU_IS_GENERATED
+#   define I2C0_HW_BACKOFF_SLOT_us (9000000UL / F_I2C0_HW)
+#endif
+#if !defined I2C0_HW_BACKOFF_SEED || defined DOXYGEN_DOCU_IS_GENERATED
+#   define I2C0_HW_BACKOFF_SEED 0x5A
+#endif
+#if (I2C0_HW_RETRY_ATTEMPTS < 1) || (I2C0_HW_RETRY_ATTEMPTS > 255)
+#   error "Retry attempts range from 1 to 255. Check your `I2C0_HW_RETRY_ATTEMPTS` setting!"
+#endif
+#if (I2C0_HW_BACKOFF_WINDOW < 1) || (I2C0_HW_BACKOFF_WINDOW > 128) || (I2C0_HW_BACKOFF_WINDOW & (I2C0_HW_BACKOFF_WINDOW - 1))
+#   error "The backoff window takes a power of 2 up to 128. Check your `I2C0_HW_BACKOFF_WINDOW` setting!"
+#endif
+#if (I2C0_HW_BACKOFF_SEED < 1) || (I2C0_HW_BACKOFF_SEED > 255)
+#   error "The backoff seed ranges from 1 to 255. Check your `I2C0_HW_BACKOFF_SEED` setting!"
+#endif
+
+
 // Just for Doxygen :(
 #if defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_hw_usi.h"
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_hw_state.h
+// Description : Declaration of the lib state the primitives work on.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_hw_state.h
+/// \brief
+/// Declaration of the failure code and the slave acknowledge behaviour.
+/// \details
+/// Shared by `i2c_lib_private.h` and the primitives headers
+/// `i2c_hw_twi_primitives.h` and `i2c_hw_usi_primitives.h`, which the
+/// application gets with `I2C0_HW_INLINE_PRIMITIVES`. Defined once in
+/// `i2c0_hw_state.c`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_HW_STATE_H_INCLUDED
+#define I2C_HW_STATE_H_INCLUDED
+
+
+#include "i2c_def.h"
+#include <inttypes.h>
+
+
+/// \brief
+/// Internal place to store the failure code(s).
+/// So far the original intention.
+/// To save RAM cells this has been redefined to serve as a status
+/// indication. So some codes are errors but others remain
+/// informative - or get errors in some but not all situations.
+/// See `i2c_def.h` for details about status codes.
+/// \note
+/// With `I2C0_HW_FAILURE_REG` set the codes are kept in this I/O register
+/// instead of RAM, see `i2c_hw.h`.
+/// The interrupt driven and the Timer0 clocked modes write it from their
+/// interrupts, it is `volatile` then.
+#if defined I2C0_HW_FAILURE_REG
+#   define i2c0_failure_info I2C0_HW_FAILURE_REG
+#elif defined I2C0_HW_INTERRUPT_DRIVEN || defined I2C0_HW_TIMER0_CLOCKED
+extern volatile enum I2C_FAILURE_type i2c0_failure_info;
+#else
+extern enum I2C_FAILURE_type i2c0_failure_info;
+#endif
+
+
+#if defined I2C0_HW_AS_SLAVE || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Internal place to store slave acknowledge behaviour.
+/// \note
+/// This RAM byte is occupied only when a slave mode is enabled.
+/// This variable is void if solely a master mode is selected.
+extern uint8_t slaveAckControl;
+#else
+   #define slaveAckControl 0
+#endif
+
+
+#endif // I2C_HW_STATE_H_INCLUDED
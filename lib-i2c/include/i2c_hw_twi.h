@@ -34,7 +34,12 @@
 
 /// \brief
 /// A shortcut to aid enabling the TWI.
+/// The interrupt driven slave keeps its interrupt enabled.
+#if defined I2C0_HW_AS_SLAVE && defined I2C0_HW_INTERRUPT_DRIVEN
+#define I2C0_ENABLE                 I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | slaveAckControl;
+#else
 #define I2C0_ENABLE                 I2C0_HW_CONTROL_REG = (1 << TWEN) | slaveAckControl;
+#endif
 
 
 /// \brief
@@ -47,9 +52,87 @@
 #define I2C0_WAITING_FOR_SLAVE      (!(I2C0_HW_READBACK & (1 << I2C0_HW_SCL_BIT)))
 
 
-// Some prototypes, used in the lib routines. Documented in their files.
-void twi0_send_byte(uint8_t dataByte);
-//uint8_t twi0_receive_byte(uint8_t transferFollows);
+/// \brief
+/// Aid for coding the timeout and the bus recovery.
+#define I2C0_SCL_IS_LOW             (!(I2C0_HW_READBACK & (1 << I2C0_HW_SCL_BIT)))
+
+
+#if defined I2C0_HW_BUS_RECOVERY || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Aid for coding the bus recovery.
+#define I2C0_SDA_IS_LOW             (!(I2C0_HW_READBACK & (1 << I2C0_HW_SDA_BIT)))
+
+
+/// \brief
+/// Aid for coding the bus recovery.
+/// \details
+/// The TWI gets disabled, the pins are port pins then.
+#define I2C0_RECOVERY_BEGIN         I2C0_DISABLE
+
+
+/// \brief
+/// Aid for coding the bus recovery.
+/// \details
+/// The TWI gets enabled again, bit rate and prescaler are kept.
+#define I2C0_RECOVERY_END           I2C0_ENABLE
+
+
+/// \brief
+/// Aid for coding the blocking single master.
+/// \details
+/// True if a slave keeps SDA low while the bus is idle, i.e. after the
+/// 'STOP', when nobody may do so.
+#define I2C0_SDA_IS_BLOCKED         (((I2C0_HW_STATUS_REG & (0b11111<<TWS3)) == 0xF8) && I2C0_SDA_IS_LOW)
+#endif
+
+
+#if defined I2C0_HW_AS_SLAVE && defined I2C0_HW_INTERRUPT_DRIVEN || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Aid for coding the interrupt driven slave.
+/// \details
+/// Hand the transfer just finished over to `twi0_slave_transfer_done()`.
+#define TWI0_SLAVE_TRANSFER_FINISHED    i2c0_slave.doneAddress = i2c0_slave.addressReceived; \
+                                        i2c0_slave.doneCount = i2c0_slave.count; \
+                                        i2c0_slave.done = ~0
+
+
+/// \brief
+/// Aid for coding the interrupt driven slave.
+/// \details
+/// Continue with the next bus event, `ack` selects the 'ACK' (!=0) or
+/// 'NACK' (0) response to the next byte.
+#define TWI0_SLAVE_CONTINUE(ack)        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | ((ack) ? slaveAckControl : 0)
+#endif
+
+
+/// \brief
+/// Aid for coding the TWI state machines.
+/// \details
+/// The TWI status codes are multiples of 8, `status >> 3` indexes a table
+/// of 32 entries. A state machine maps the codes it handles to a dense
+/// range of events by such a table in flash, then dispatches by a `switch`
+/// over the events. The codes sharing an event are no longer compared one
+/// by one. Whether the `switch` becomes a table jump or stays a short
+/// chain of compares over the events depends on the case values
+/// threshold of avr-gcc (`--param case-values-threshold`), a state machine
+/// of a few events may well stay below it. Codes left out get event 0.
+/// \code
+/// static const uint8_t events[32] PROGMEM =
+/// {
+///     [TWI0_STATUS_INDEX(0x60)] = ADDRESSED,
+///     ...
+/// };
+/// switch (TWI0_STATUS_EVENT(events))
+/// \endcode
+/// The prescaler bits of the status register are shifted out.
+#define TWI0_STATUS_INDEX(status)       ((status) >> 3)
+
+
+/// \brief
+/// Aid for coding the TWI state machines.
+/// \details
+/// Event of the current TWI status from `table`, see `TWI0_STATUS_INDEX()`.
+#define TWI0_STATUS_EVENT(table)        pgm_read_byte(&(table)[I2C0_HW_STATUS_REG >> 3])
 
 
 // =============================================================================
@@ -68,6 +151,12 @@ void twi0_send_byte(uint8_t dataByte);
 #   define I2C0_HW_CONTROL_REG          TWCR
 #   define I2C0_HW_DATA_REG             TWDR
 #   define I2C0_HW_STATUS_REG           TWSR
+#   define I2C0_HW_TIMEOUT_MODE_REG     TCCR1A
+#   define I2C0_HW_TIMEOUT_CLOCK_REG    TCCR1B
+#   define I2C0_HW_TIMEOUT_COUNT_REG    TCNT1
+#   define I2C0_HW_TIMEOUT_COMPARE_REG  OCR1B
+#   define I2C0_HW_TIMEOUT_FLAG_REG     TIFR
+#   define I2C0_HW_TIMEOUT_FLAG_BIT     OCF1B
 
 #elif defined (__AVR_ATmega328__) || defined (__AVR_ATmega168__) || defined (__AVR_ATmega88__) || defined (__AVR_ATmega48__)
 #   define I2C0_HW_PORT                 PORTC
@@ -81,6 +170,12 @@ void twi0_send_byte(uint8_t dataByte);
 #   define I2C0_HW_CONTROL_REG          TWCR
 #   define I2C0_HW_DATA_REG             TWDR
 #   define I2C0_HW_STATUS_REG           TWSR
+#   define I2C0_HW_TIMEOUT_MODE_REG     TCCR1A
+#   define I2C0_HW_TIMEOUT_CLOCK_REG    TCCR1B
+#   define I2C0_HW_TIMEOUT_COUNT_REG    TCNT1
+#   define I2C0_HW_TIMEOUT_COMPARE_REG  OCR1B
+#   define I2C0_HW_TIMEOUT_FLAG_REG     TIFR1
+#   define I2C0_HW_TIMEOUT_FLAG_BIT     OCF1B
 
 #elif defined (__AVR_ATmega16U4__) || defined (__AVR_ATmega32U4__)
 #   define I2C0_HW_PORT                 PORTD
@@ -94,6 +189,12 @@ void twi0_send_byte(uint8_t dataByte);
 #   define I2C0_HW_CONTROL_REG          TWCR
 #   define I2C0_HW_DATA_REG             TWDR
 #   define I2C0_HW_STATUS_REG           TWSR
+#   define I2C0_HW_TIMEOUT_MODE_REG     TCCR1A
+#   define I2C0_HW_TIMEOUT_CLOCK_REG    TCCR1B
+#   define I2C0_HW_TIMEOUT_COUNT_REG    TCNT1
+#   define I2C0_HW_TIMEOUT_COMPARE_REG  OCR1B
+#   define I2C0_HW_TIMEOUT_FLAG_REG     TIFR1
+#   define I2C0_HW_TIMEOUT_FLAG_BIT     OCF1B
 
 #else
 #   error "MCU type not known to i2c_hw_twi.h (or no MCU type defined at all)."
@@ -104,11 +205,7 @@ void twi0_send_byte(uint8_t dataByte);
 // Prepare hardware support for bus timing.
 // =============================================================================
 
-#if ((F_CPU/F_I2C0_HW) < 16)
-#    define twiDivisor           0
-#else
-#    define twiDivisor           (((F_CPU/F_I2C0_HW)-16)/2)
-#endif
+#define twiDivisor              I2C0_DIVISOR(F_I2C0_HW)
 
 #if (twiDivisor < 256)
 #    if (twiDivisor < 10)
@@ -134,6 +231,100 @@ void twi0_send_byte(uint8_t dataByte);
 #endif
 
 
+// The speed profiles. A profile exists only if its divisor needs no
+// correction, see `I2C0_BITRATE_OF()` in `i2c_hw.h`.
+#define I2C0_SPEED_DEFAULT      0   /* F_I2C0_HW */
+#if (I2C0_DIVISOR(100000UL) >= 10)
+#    define I2C0_SPEED_100k     1
+#endif
+#if (I2C0_DIVISOR(400000UL) >= 10)
+#    define I2C0_SPEED_400k     2
+#endif
+#if (I2C0_DIVISOR(1000000UL) >= 10)
+#    define I2C0_SPEED_1M       3
+#endif
+
+
+// =============================================================================
+// Prepare hardware support for the emergency timeout.
+// =============================================================================
+
+#if defined I2C0_HW_TIMEOUT_TIMER1 || defined DOXYGEN_DOCU_IS_GENERATED
+// Timer1 ticks of `I2C0_HW_EMERGENCY_TIMEOUT_us` at `prescaler`, rounded up.
+// Calculated in 64 bits like the preprocessor does, the product exceeds
+// the 32 bits of an `unsigned long` beyond some 268 ms at 16 MHz.
+#define I2C0_TIMEOUT_TICKS_OF(prescaler)    ((I2C0_HW_EMERGENCY_TIMEOUT_us * (F_CPU / 1000ULL) / (prescaler) + 999ULL) / 1000ULL)
+
+// The smallest prescaler to fit the timeout into the 16 bit counter.
+#if (I2C0_TIMEOUT_TICKS_OF(1) < 0x10000)
+#    define I2C0_TIMEOUT_PRESCALER      1
+#    define I2C0_TIMEOUT_CLOCK_SELECT   0x01 /* :1 */
+#elif (I2C0_TIMEOUT_TICKS_OF(8) < 0x10000)
+#    define I2C0_TIMEOUT_PRESCALER      8
+#    define I2C0_TIMEOUT_CLOCK_SELECT   0x02 /* :8 */
+#elif (I2C0_TIMEOUT_TICKS_OF(64) < 0x10000)
+#    define I2C0_TIMEOUT_PRESCALER      64
+#    define I2C0_TIMEOUT_CLOCK_SELECT   0x03 /* :64 */
+#elif (I2C0_TIMEOUT_TICKS_OF(256) < 0x10000)
+#    define I2C0_TIMEOUT_PRESCALER      256
+#    define I2C0_TIMEOUT_CLOCK_SELECT   0x04 /* :256 */
+#elif (I2C0_TIMEOUT_TICKS_OF(1024) < 0x10000)
+#    define I2C0_TIMEOUT_PRESCALER      1024
+#    define I2C0_TIMEOUT_CLOCK_SELECT   0x05 /* :1024 */
+#else
+#    error "'I2C0_HW_EMERGENCY_TIMEOUT_us' exceeds the range of Timer1. Check your `I2C0_HW_TIMEOUT_TIMER1` setting!"
+#endif
+#define I2C0_TIMEOUT_TICKS              ((uint16_t)I2C0_TIMEOUT_TICKS_OF(I2C0_TIMEOUT_PRESCALER))
+
+
+/// \brief
+/// Aid for coding the setup routines.
+/// \details
+/// Timer1 runs free (normal mode) at `I2C0_TIMEOUT_PRESCALER`.
+#define I2C0_TIMEOUT_SETUP              I2C0_HW_TIMEOUT_MODE_REG = 0; \
+                                        I2C0_HW_TIMEOUT_CLOCK_REG = I2C0_TIMEOUT_CLOCK_SELECT
+
+
+/// \brief
+/// Aid for coding the TWI waits.
+/// \details
+/// Sets the compare match of OCR1B `I2C0_HW_EMERGENCY_TIMEOUT_us` ahead
+/// of the counter and clears its flag. The flag gets set by the timer
+/// once the time is up, polling it is a single `sbis` instruction.
+#define I2C0_TIMEOUT_ARM                I2C0_HW_TIMEOUT_COMPARE_REG = I2C0_HW_TIMEOUT_COUNT_REG + I2C0_TIMEOUT_TICKS; \
+                                        I2C0_HW_TIMEOUT_FLAG_REG = (1 << I2C0_HW_TIMEOUT_FLAG_BIT)
+
+
+/// \brief
+/// Aid for coding the TWI waits.
+/// \details
+/// True once the time set by `I2C0_TIMEOUT_ARM` is up.
+#define I2C0_TIMEOUT_EXPIRED            (I2C0_HW_TIMEOUT_FLAG_REG & (1 << I2C0_HW_TIMEOUT_FLAG_BIT))
+#endif
+
+
+// =============================================================================
+// The byte primitives. Their bodies live in `i2c_hw_twi_primitives.h`,
+// the lib file of the same name wraps the body into the function. With
+// `I2C0_HW_INLINE_PRIMITIVES` set the lib and the application use the
+// bodies, the files are void. Else the application does not see them.
+// =============================================================================
+
+#if defined I2C0_HW_INLINE_PRIMITIVES
+#   include "i2c_hw_twi_primitives.h"
+#   define twi0_send_byte                       twi0_send_byte_inline
+#   define twi0_check4Error                     twi0_check4Error_inline
+#   define twi0_assert_stop_sequence            twi0_assert_stop_sequence_inline
+#   define twi0_send_byte_single_master         twi0_send_byte_single_master_inline
+#   define twi0_receive_byte_single_master      twi0_receive_byte_single_master_inline
+#   define twi0_send_byte_multi_master          twi0_send_byte_multi_master_inline
+#   define twi0_receive_byte_multi_master       twi0_receive_byte_multi_master_inline
+#else
+// Used in the lib routines. Documented in its file.
+uint8_t twi0_send_byte(uint8_t dataByte);
+#endif
+
+
 // =============================================================================
 // Map implementation to standardized API.
 // =============================================================================
@@ -177,6 +368,24 @@ uint8_t twi0_receive_byte_slave_multi_master(uint8_t sendAck);
 #            define hardI2c0_setSlaveResponse    twi0_set_slave_response
 void twi0_set_slave_response(uint8_t on);
 #        endif
+#    elif defined I2C0_HW_INTERRUPT_DRIVEN
+#        // opmode: slave, interrupt driven
+#        ifndef I2C0_HW_NO_SLAVE_ADDRESS_MASK
+#            define hardI2c0_init(p1,p2,p3,p4)   twi0_setup_slave_isr(p1,p2)
+void twi0_setup_slave_isr(uint8_t slaveAddress,
+                          uint8_t slaveMask);
+#        else
+#            define hardI2c0_init(p1,p2,p3,p4)   twi0_setup_slave_isr(p1)
+void twi0_setup_slave_isr(uint8_t slaveAddress);
+#        endif
+#        define hardI2c0_setSlaveBuffers         twi0_set_slave_buffers
+void twi0_set_slave_buffers(uint8_t *rxBuffer, uint8_t rxSize, uint8_t *txBuffer, uint8_t txSize);
+#        define hardI2c0_setSlaveRegisterFile    twi0_set_slave_register_file
+uint8_t twi0_set_slave_register_file(uint8_t *registers, uint8_t size);
+#        define hardI2c0_slaveTransferDone       twi0_slave_transfer_done
+uint8_t twi0_slave_transfer_done(uint8_t *addressReceived, uint8_t *byteCount);
+#        define hardI2c0_setSlaveResponse        twi0_set_slave_response
+void twi0_set_slave_response(uint8_t on);
 #    else
 #        // opmode: slave
 #        ifndef I2C0_HW_NO_SLAVE_ADDRESS_MASK
@@ -231,4 +440,96 @@ void twi0_assert_stop_sequence(void);
 #endif
 
 
+// =============================================================================
+// Map block and combined transfers to standardized API, any master mode.
+// =============================================================================
+
+#if defined I2C0_HW_AS_MASTER
+#    define hardI2c0_writeBlock          twi0_write_block
+enum I2C_FAILURE_type twi0_write_block(const uint8_t *buffer, uint16_t length);
+#    define hardI2c0_readBlock           twi0_read_block
+enum I2C_FAILURE_type twi0_read_block(uint8_t *buffer, uint16_t length);
+#    define hardI2c0_writeRead           i2c0_write_read
+enum I2C_FAILURE_type i2c0_write_read(uint8_t deviceAddress,
+                                      const uint8_t *writeBuffer,
+                                      uint16_t writeCount,
+                                      uint8_t *readBuffer,
+                                      uint16_t readCount);
+#    if !defined I2C0_HW_SINGLE_MASTER
+#        define hardI2c0_openDeviceRetry     i2c0_open_device_retry
+enum I2C_FAILURE_type i2c0_open_device_retry(uint8_t deviceAddress, void (*serveSlave)(void));
+#    endif
+#    if defined I2C0_HW_BUS_RECOVERY
+#        define hardI2c0_recoverBus          i2c0_recover_bus
+enum I2C_FAILURE_type i2c0_recover_bus(void);
+#    endif
+#    if defined I2C0_HW_SPEED_SLAVES
+#        if (I2C0_HW_SPEED_SLAVES < 1) || (I2C0_HW_SPEED_SLAVES > 32)
+#            error "Speed profiles are kept for 1 to 32 slaves. Check your `I2C0_HW_SPEED_SLAVES` setting!"
+#        endif
+#        define hardI2c0_setSlaveSpeed       twi0_set_slave_speed
+uint8_t twi0_set_slave_speed(uint8_t deviceAddress, uint8_t profile);
+// Used in the lib routines. Documented in its file.
+void twi0_select_speed(uint8_t deviceAddress);
+#    endif
+#endif
+
+// =============================================================================
+// Map interrupt driven engine(s) to standardized API.
+// =============================================================================
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN
+#    if defined I2C0_HW_AS_MASTER
+#        if defined I2C0_HW_AS_SLAVE
+#            // opmode: multi master + slave, interrupt driven
+#            error "Interrupt driven multi master + slave is not supported. Check your `I2C0_HW_INTERRUPT_DRIVEN` and `I2C0_HW_AS_SLAVE` settings!"
+#        endif
+#        // opmode: single master or multi master, interrupt driven
+#        define hardI2c0_startTransaction    twi0_start_transaction
+uint8_t twi0_start_transaction(uint8_t deviceAddress,
+                               uint8_t *writeBuffer,
+                               uint16_t writeCount,
+                               uint8_t *readBuffer,
+                               uint16_t readCount);
+#        if defined I2C0_HW_QUEUE_SIZE
+#            if (I2C0_HW_QUEUE_SIZE < 2) || (I2C0_HW_QUEUE_SIZE > 128) || (I2C0_HW_QUEUE_SIZE & (I2C0_HW_QUEUE_SIZE - 1))
+#                error "The transaction queue takes a power of 2 from 2 to 128. Check your `I2C0_HW_QUEUE_SIZE` setting!"
+#            endif
+#            define hardI2c0_submitTransaction   twi0_submit_transaction_queued
+uint8_t twi0_submit_transaction_queued(uint8_t deviceAddress,
+                                       uint8_t *writeBuffer,
+                                       uint16_t writeCount,
+                                       uint8_t *readBuffer,
+                                       uint16_t readCount,
+                                       struct I2C_STATUS_type *status);
+#        else
+#            define hardI2c0_submitTransaction   twi0_submit_transaction
+uint8_t twi0_submit_transaction(uint8_t deviceAddress,
+                                uint8_t *writeBuffer,
+                                uint16_t writeCount,
+                                uint8_t *readBuffer,
+                                uint16_t readCount,
+                                struct I2C_STATUS_type *status);
+#        endif
+#        define hardI2c0_isBusy              twi0_transaction_pending
+uint8_t twi0_transaction_pending(void);
+#    endif
+#endif
+#if defined I2C0_HW_QUEUE_SIZE && !(defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_MASTER)
+#    error "The transaction queue is available for the interrupt driven master only. Check your `I2C0_HW_QUEUE_SIZE` and `I2C0_HW_INTERRUPT_DRIVEN` settings!"
+#endif
+#if defined I2C0_HW_SPEED_SLAVES && (defined I2C0_HW_INTERRUPT_DRIVEN || !defined I2C0_HW_AS_MASTER)
+#    error "Speed profiles are switched by `hardI2c0_openDevice()`, the blocking master modes only. Check your `I2C0_HW_SPEED_SLAVES` and `I2C0_HW_INTERRUPT_DRIVEN` settings!"
+#endif
+#if defined I2C0_HW_CHAIN_TRANSACTIONS && !defined I2C0_HW_QUEUE_SIZE
+#    error "Chained transactions are taken from the transaction queue. Check your `I2C0_HW_CHAIN_TRANSACTIONS` and `I2C0_HW_QUEUE_SIZE` settings!"
+#endif
+#if defined I2C0_HW_BUS_RECOVERY && (defined I2C0_HW_INTERRUPT_DRIVEN || !defined I2C0_HW_AS_MASTER)
+#    error "The bus gets recovered by the blocking master modes only. Check your `I2C0_HW_BUS_RECOVERY`, `I2C0_HW_AS_MASTER` and `I2C0_HW_INTERRUPT_DRIVEN` settings!"
+#endif
+#if defined I2C0_HW_TIMEOUT_TIMER1 && defined I2C0_HW_INTERRUPT_DRIVEN
+#    error "The interrupt driven modes do not wait for the TWI, there is nothing to time out. Check your `I2C0_HW_TIMEOUT_TIMER1` and `I2C0_HW_INTERRUPT_DRIVEN` settings!"
+#endif
+
+
 #endif // I2C_HW_TWI_H_INCLUDED
@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_hw_twi_primitives.h
+// Description : Bodies of the TWI byte primitives.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_hw_twi_primitives.h
+/// \brief
+/// Bodies of the TWI byte primitives.
+/// \details
+/// The lib file of the same name wraps a body into the function, the lib
+/// routines get this header by `i2c_lib_private.h`. The application gets
+/// it by `i2c_hw_twi.h` with `I2C0_HW_INLINE_PRIMITIVES` set only, along
+/// with `<avr/io.h>` and the failure code the bodies need.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_HW_TWI_PRIMITIVES_H_INCLUDED
+#define I2C_HW_TWI_PRIMITIVES_H_INCLUDED
+
+
+#include "i2c_hw_state.h"
+#include <avr/io.h>
+
+#if defined I2C0_HW_BUS_RECOVERY
+// Used by the waits. Documented in its file.
+enum I2C_FAILURE_type i2c0_recover_bus(void);
+#endif
+
+
+/// \brief
+/// Inline, always. The bodies are no functions of their own.
+#define TWI0_INLINE                 static inline __attribute__((always_inline))
+
+
+/// \brief
+/// Waits for TWINT, the end of the bus operation started.
+/// \details
+/// With `I2C0_HW_TIMEOUT_TIMER1` the wait ends after
+/// `I2C0_HW_EMERGENCY_TIMEOUT_us` at the latest, e.g. if a slave keeps
+/// SCL low. The failure code gets `I2C_TIMED_OUT` then and the TWI is
+/// reset, which drops the bus operation and releases the lines. The
+/// single master with `I2C0_HW_BUS_RECOVERY` recovers the bus as well,
+/// see `i2c0_recover_bus()`, unless a slave still keeps SCL low.
+/// Without `I2C0_HW_TIMEOUT_TIMER1` the wait is unbounded: a slave
+/// keeping SCL low stalls it for good, `I2C0_HW_EMERGENCY_TIMEOUT_us`
+/// does not apply.
+/// \returns 0 if the bus operation is done, ~0 if timed out.
+TWI0_INLINE uint8_t twi0_wait_for_twint(void)
+{
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_ARM;
+    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT)))
+    {
+        if (I2C0_TIMEOUT_EXPIRED)
+        {
+#if defined I2C0_HW_BUS_RECOVERY && defined I2C0_HW_SINGLE_MASTER
+            // SCL still low without the TWI is a slave stretching, no
+            // use to wait for it a second time.
+            I2C0_DISABLE;
+            if (I2C0_SCL_IS_LOW)
+            {
+                I2C0_ENABLE;
+            }
+            else
+            {
+                i2c0_recover_bus();
+            }
+#else
+            I2C0_DISABLE;
+            I2C0_ENABLE;
+#endif
+            i2c0_failure_info |= I2C_TIMED_OUT;
+            return(~0);
+        }
+    }
+#else
+    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+#endif
+    return(0);
+}
+
+
+#if !defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Waits for TWINT after the 'START' of a multi master.
+/// \details
+/// The 'START' waits as long as another master holds the bus, e.g. for
+/// a chain of transactions. That is no failure, so the timeout of
+/// `I2C0_HW_TIMEOUT_TIMER1` starts anew each time SCL is seen high. It
+/// ends the wait only if SCL stays low for `I2C0_HW_EMERGENCY_TIMEOUT_us`,
+/// like `twi0_wait_for_twint()` does. A master keeping SCL low that long
+/// between two bytes is taken for stuck as well.
+/// \returns 0 if the 'START' is done, ~0 if timed out.
+TWI0_INLINE uint8_t twi0_wait_for_start(void)
+{
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_ARM;
+    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT)))
+    {
+        if (!I2C0_SCL_IS_LOW)
+        {
+            I2C0_TIMEOUT_ARM;
+        }
+        else if (I2C0_TIMEOUT_EXPIRED)
+        {
+            I2C0_DISABLE;
+            I2C0_ENABLE;
+            i2c0_failure_info |= I2C_TIMED_OUT;
+            return(~0);
+        }
+    }
+#else
+    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+#endif
+    return(0);
+}
+#endif
+
+
+/// \brief
+/// Body of `twi0_send_byte()`.
+TWI0_INLINE uint8_t twi0_send_byte_inline(uint8_t dataByte)
+{
+    // Prepare data byte.
+    I2C0_HW_DATA_REG = dataByte;
+    // Start transmission, always expect ACK.
+    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
+    // Wait until finished.
+    return(twi0_wait_for_twint());
+}
+
+
+/// \brief
+/// Body of `twi0_check4Error()`.
+TWI0_INLINE enum I2C_FAILURE_type twi0_check4Error_inline(void)
+{
+    return(i2c0_failure_info);
+}
+
+
+#if defined I2C0_HW_AS_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `twi0_assert_stop_sequence()`.
+TWI0_INLINE void twi0_assert_stop_sequence_inline(void)
+{
+    // Assert stop condition.
+    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+    // Wait until done. Necessary?
+//  while (I2C0_HW_CONTROL_REG & (1 << TWSTO)) {}
+}
+#endif
+
+
+#if !defined I2C0_HW_AS_SLAVE && defined I2C0_HW_AS_MASTER && defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `twi0_send_byte_single_master()`.
+TWI0_INLINE void twi0_send_byte_single_master_inline(uint8_t dataByte)
+{
+    if (twi0_send_byte_inline(dataByte))
+        return;
+    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    {
+        case 0x28:  /* data successfully sent */
+            break;
+        case 0x30:  /* data sent, but no ACK received */
+            i2c0_failure_info |= I2C_NO_ACK;
+            break;
+        default:
+            i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+    }
+}
+
+
+/// \brief
+/// Body of `twi0_receive_byte_single_master()`.
+TWI0_INLINE uint8_t twi0_receive_byte_single_master_inline(uint8_t transferFollows)
+{
+    // Start reception; select ACK option.
+    if (transferFollows)
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
+    else
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
+    // Wait until finished.
+    if (twi0_wait_for_twint())
+        return(0xFF);
+    uint8_t dataByte = I2C0_HW_DATA_REG;
+    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    {
+        case 0x50:  /* data successfully received, ACK sent */
+        case 0x58:  /* data successfully received, but no ACK sent */
+            break;
+        default:
+            i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+    }
+    return(dataByte);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `twi0_send_byte_multi_master()`.
+TWI0_INLINE void twi0_send_byte_multi_master_inline(uint8_t dataByte)
+{
+    if (twi0_send_byte_inline(dataByte))
+        return;
+    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    {
+        case 0x28:  /* data successfully sent */
+            i2c0_failure_info = I2C_SUCCESS;
+            break;
+        case 0x30:  /* data sent, but no ACK received */
+            i2c0_failure_info = I2C_NO_ACK;
+            break;
+        case 0x38:  /* arbitration lost while sending data */
+            i2c0_failure_info = I2C_ARBITRATION_LOST;
+//          I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTA) | slaveAckControl; // release SCL
+            break;
+        case 0x00:
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+        default:
+            i2c0_failure_info = I2C_PROTOCOL_FAIL;
+    }
+}
+
+
+/// \brief
+/// Body of `twi0_receive_byte_multi_master()`.
+TWI0_INLINE uint8_t twi0_receive_byte_multi_master_inline(uint8_t transferFollows)
+{
+    // Start reception; select ACK option.
+    if (transferFollows)
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
+    else
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
+    // Wait until finished.
+    if (twi0_wait_for_twint())
+        return(0xFF);
+    uint8_t dataByte = I2C0_HW_DATA_REG;
+    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    {
+        case 0x50:  /* data successfully received, ACK sent */
+        case 0x58:  /* data successfully received, but no ACK sent */
+            i2c0_failure_info = I2C_SUCCESS;
+            break;
+        case 0x00:
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+        default:
+            i2c0_failure_info = I2C_PROTOCOL_FAIL;
+    }
+    return(dataByte);
+}
+#endif
+
+
+#endif // I2C_HW_TWI_PRIMITIVES_H_INCLUDED
@@ -29,12 +29,148 @@
 
 
 #include "i2c_def.h"
+#include "i2c_timing.h"
 #include <inttypes.h>
 
 
 /// \brief
-/// Waits half of the desired bit time to achieve bus frequency with USI.
-#define USI0_HALFBIT_DELAY              _delay_us(500000UL/F_I2C0_HW);
+/// CPU cycles of one bit time at the desired bus frequency.
+#define USI0_BIT_CYCLES                 I2C_BIT_CYCLES(F_I2C0_HW)
+
+
+/// \brief
+/// CPU cycles of the SCL low phase, see `I2C_LOW_PHASE_CYCLES()`.
+#define USI0_LOW_PHASE_CYCLES           I2C_LOW_PHASE_CYCLES(F_I2C0_HW)
+
+
+/// \brief
+/// CPU cycles of the SCL high phase.
+#define USI0_HIGH_PHASE_CYCLES          I2C_HIGH_PHASE_CYCLES(F_I2C0_HW)
+
+
+/// \brief
+/// CPU cycles spent by the bit loop code during the SCL low phase.
+/// \details
+/// Estimated from the C source of the bit loops between pulling and
+/// releasing SCL: shifter clock, loop test and delay, one cycle per ALU
+/// instruction, two per `sbi`/`cbi` and taken branch. The multi master
+/// loop calls a subroutine per bit and checks for bus contention, thus
+/// takes longer. With the subroutine inline (`I2C0_HW_INLINE_PRIMITIVES`)
+/// its call and return (7 cycles) are gone.
+/// The estimates are neither taken from a compiler listing nor checked by
+/// a measured SCL period yet. To do so, count the cycles from the `cbi`
+/// pulling SCL to the `sbi` releasing it in the `.lst` files the demo
+/// makefiles write next to the lib sources (or `avr-objdump -d`), and
+/// compare the SCL period at the pin with `USI0_BIT_CYCLES`. If they
+/// differ override this definition in the Makefile.
+#ifndef USI0_LOW_PHASE_OVERHEAD_CYCLES
+#   if defined I2C0_HW_SINGLE_MASTER
+#       define USI0_LOW_PHASE_OVERHEAD_CYCLES   10
+#   elif defined I2C0_HW_INLINE_PRIMITIVES
+#       define USI0_LOW_PHASE_OVERHEAD_CYCLES   16
+#   else
+#       define USI0_LOW_PHASE_OVERHEAD_CYCLES   24
+#   endif
+#endif
+
+
+/// \brief
+/// CPU cycles spent by the bit loop code during the SCL high phase.
+/// \details
+/// Estimated like `USI0_LOW_PHASE_OVERHEAD_CYCLES`, from releasing to
+/// pulling SCL, clock stretching not taken into account. Not checked
+/// against a listing or a measured SCL period yet either. If your
+/// compiler generates different code override this definition in the
+/// Makefile.
+#ifndef USI0_HIGH_PHASE_OVERHEAD_CYCLES
+#   if defined I2C0_HW_SINGLE_MASTER
+#       define USI0_HIGH_PHASE_OVERHEAD_CYCLES  6
+#   else
+#       define USI0_HIGH_PHASE_OVERHEAD_CYCLES  8
+#   endif
+#endif
+
+
+/// \brief
+/// Waits `cycles` CPU cycles less the already spent `overhead`.
+#define USI0_DELAY_REMAINING_CYCLES(cycles, overhead) \
+    I2C_DELAY_REMAINING_CYCLES(cycles, overhead)
+
+
+#if defined I2C0_HW_RUNTIME_SPEED || defined DOXYGEN_DOCU_IS_GENERATED
+#include <util/delay_basic.h>
+
+
+/// \brief
+/// CPU cycles of the SCL low phase with `loops` iterations of the
+/// calibrated delay loop.
+/// \details
+/// `_delay_loop_1()` takes 3 cycles per iteration less 1 at its end, the
+/// 8 bit count loaded from RAM adds 2.
+#define USI0_LOW_PHASE_LOOP_CYCLES(loops) \
+    (USI0_LOW_PHASE_OVERHEAD_CYCLES + 3UL * (loops) + 1)
+
+
+/// \brief
+/// CPU cycles of the SCL high phase with `loops` iterations of the
+/// calibrated delay loop.
+/// \details
+/// `_delay_loop_2()` takes 4 cycles per iteration less 1 at its end, the
+/// 16 bit count loaded from RAM adds 4.
+#define USI0_HIGH_PHASE_LOOP_CYCLES(loops) \
+    (USI0_HIGH_PHASE_OVERHEAD_CYCLES + 4UL * (loops) + 3)
+
+
+/// \brief
+/// Set if `usi0_set_speed()` calibrated the delay loops, clear while the
+/// bus runs at `F_I2C0_HW`.
+#define USI0_PHASES_CALIBRATED          (i2c0_low_phase_loops != 0)
+
+
+/// \brief
+/// Waits the remaining SCL low time, by the calibrated delay loop if
+/// `calibrated` is set, else as fixed by `F_I2C0_HW`.
+/// \details
+/// The bit loops take `calibrated` as a constant, once per byte, so their
+/// bit time holds no test of it.
+#define USI0_LOW_PHASE_DELAY_OF(calibrated)                                         \
+    do                                                                              \
+    {                                                                               \
+        if (calibrated)                                                             \
+            _delay_loop_1(i2c0_low_phase_loops);                                    \
+        else                                                                        \
+            USI0_DELAY_REMAINING_CYCLES(USI0_LOW_PHASE_CYCLES, USI0_LOW_PHASE_OVERHEAD_CYCLES); \
+    } while (0)
+
+
+/// \brief
+/// Waits the remaining SCL high time, by the calibrated delay loop if
+/// `calibrated` is set, else as fixed by `F_I2C0_HW`.
+#define USI0_HIGH_PHASE_DELAY_OF(calibrated)                                        \
+    do                                                                              \
+    {                                                                               \
+        if (calibrated)                                                             \
+            _delay_loop_2(i2c0_high_phase_loops);                                   \
+        else                                                                        \
+            USI0_DELAY_REMAINING_CYCLES(USI0_HIGH_PHASE_CYCLES, USI0_HIGH_PHASE_OVERHEAD_CYCLES); \
+    } while (0)
+#else
+#define USI0_PHASES_CALIBRATED          0
+#define USI0_LOW_PHASE_DELAY_OF(calibrated) \
+    USI0_DELAY_REMAINING_CYCLES(USI0_LOW_PHASE_CYCLES, USI0_LOW_PHASE_OVERHEAD_CYCLES)
+#define USI0_HIGH_PHASE_DELAY_OF(calibrated) \
+    USI0_DELAY_REMAINING_CYCLES(USI0_HIGH_PHASE_CYCLES, USI0_HIGH_PHASE_OVERHEAD_CYCLES)
+#endif
+
+
+/// \brief
+/// Waits the remaining SCL low time to achieve bus frequency with USI.
+#define USI0_LOW_PHASE_DELAY            USI0_LOW_PHASE_DELAY_OF(USI0_PHASES_CALIBRATED);
+
+
+/// \brief
+/// Waits the remaining SCL high time to achieve bus frequency with USI.
+#define USI0_HIGH_PHASE_DELAY           USI0_HIGH_PHASE_DELAY_OF(USI0_PHASES_CALIBRATED);
 
 
 /// \brief
@@ -62,6 +198,24 @@
 #define I2C0_SCL_AND_SDA_ARE_HIGH       ((I2C0_HW_READBACK & ((1 << I2C0_HW_SCL_BIT) | (1 << I2C0_HW_SDA_BIT))) == ((1 << I2C0_HW_SCL_BIT) | (1 << I2C0_HW_SDA_BIT)))
 
 
+#if defined I2C0_HW_BUS_RECOVERY || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Aid for coding the bus recovery.
+/// \details
+/// The two wire mode gets off, the pins are port pins then.
+#define I2C0_RECOVERY_BEGIN             I2C0_HW_CONTROL_REG = 0
+
+
+/// \brief
+/// Aid for coding the bus recovery.
+/// \details
+/// Back to two wire mode, as left by the 'STOP'. The flags of the
+/// conditions seen meanwhile are cleared.
+#define I2C0_RECOVERY_END               I2C0_HW_STATUS_REG = (1 << USIOIF) | (1 << USISIF) | (1 << USIPF); \
+                                        I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE
+#endif
+
+
 /// \brief
 /// Aid for coding USI routines.
 /// \details
@@ -205,6 +359,116 @@
 #define USI_COUNT_FOR_A_BIT_MASTER      15
 
 
+#if defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// USICR setting of the Timer0 clocked master.
+/// The shifter samples at the rising SCL edge, SCL is toggled by USITC and
+/// the 4-bit counter counts both SCL edges. SCL is held low on counter
+/// overflow until the overflow interrupt has prepared the next phase.
+#define USI0_TIMER0_MASTER_MODE         ((1 << USIOIE) | USI_HOLD_ON_ALL | USI_SAMPLE_ON_RISING_EDGE | (1 << USICLK))
+
+
+/// \brief
+/// CPU cycles of half of a bit time for the Timer0 clocked master.
+#define USI0_TIMER0_HALFBIT_CYCLES      ((F_CPU + F_I2C0_HW) / (2 * F_I2C0_HW))
+#if USI0_TIMER0_HALFBIT_CYCLES < 40
+#   error "F_I2C0_HW too high for the Timer0 clocked USI master at this F_CPU. The interrupt needs about 20 cycles per half bit."
+#elif USI0_TIMER0_HALFBIT_CYCLES <= 256
+#   define USI0_TIMER0_PRESCALER        (1 << CS00)
+#   define USI0_TIMER0_COMPARE          (USI0_TIMER0_HALFBIT_CYCLES - 1)
+#else
+#   define USI0_TIMER0_PRESCALER        (1 << CS01)
+#   define USI0_TIMER0_COMPARE          ((USI0_TIMER0_HALFBIT_CYCLES + 4) / 8 - 1)
+#endif
+/// \brief
+/// The clock select bits of Timer0, `USI0_TIMER0_PRESCALER` replaces them.
+#define USI0_TIMER0_CLOCK_SELECT        ((1 << CS02) | (1 << CS01) | (1 << CS00))
+
+
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// Restart Timer0 to clock SCL after half of a bit time.
+#define USI0_TIMER0_START               I2C0_HW_TIMER_COUNT_REG = 0; \
+                                        I2C0_HW_TIMER_IRQ_FLAG_REG = (1 << I2C0_HW_TIMER_IRQ_FLAG_BIT); \
+                                        I2C0_HW_TIMER_IRQ_MASK_REG |= (1 << I2C0_HW_TIMER_IRQ_ENABLE_BIT)
+
+
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// Stop clocking SCL by Timer0.
+#define USI0_TIMER0_STOP                I2C0_HW_TIMER_IRQ_MASK_REG &= ~(1 << I2C0_HW_TIMER_IRQ_ENABLE_BIT)
+
+
+/// \brief
+/// States of the Timer0 clocked master, see `i2c0_bit_engine_state`.
+enum USI0_TIMER0_STATE_type
+{
+    USI0_TIMER0_IDLE = 0,       ///< Nothing to do, SCL is kept low.
+    USI0_TIMER0_TX_DATA,        ///< Sending a data byte.
+    USI0_TIMER0_TX_ACK,         ///< Reading the ACK of the slave.
+    USI0_TIMER0_RX_DATA_ACK,    ///< Receiving a data byte, ACK follows.
+    USI0_TIMER0_RX_DATA_NACK,   ///< Receiving a data byte, NACK follows.
+    USI0_TIMER0_RX_ACK          ///< Sending the ACK or NACK.
+};
+
+
+// \brief
+// Wait until the Timer0 clocked master has finished the byte in progress.
+void usi0_wait_until_done_timer0_master(void);
+#endif
+
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// States of the interrupt driven slave, see `i2c0_slave`.
+/// \details
+/// All states from `USI0_SLAVE_SEND_DATA` on belong to a transfer in
+/// progress.
+enum USI0_SLAVE_STATE_type
+{
+    USI0_SLAVE_IDLE = 0,                ///< Waiting for a START.
+    USI0_SLAVE_CHECK_ADDRESS,           ///< Receiving the address field.
+    USI0_SLAVE_SEND_DATA,               ///< Next is a byte to send.
+    USI0_SLAVE_REQUEST_REPLY,           ///< Byte sent, next is the master's reply.
+    USI0_SLAVE_CHECK_REPLY,             ///< Master's reply received.
+    USI0_SLAVE_REQUEST_DATA,            ///< Next is a byte to receive.
+    USI0_SLAVE_GET_DATA,                ///< Byte received, next is the ACK.
+    USI0_SLAVE_RELEASE                  ///< NACK sent, transfer ends.
+};
+
+
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// Wait for a START only, no SCL hold except by the START detector.
+#define USI0_SLAVE_WAIT_FOR_START       I2C0_HW_CONTROL_REG = (1 << USISIE) | USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE
+
+
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// Transfer bits by the counter overflow interrupt, SCL is held low on
+/// overflow until the next phase is set up. `edge` is
+/// `USI_SAMPLE_ON_RISING_EDGE` to send a data byte,
+/// `USI_SAMPLE_ON_FALLING_EDGE` otherwise.
+#define USI0_SLAVE_TRANSFER_BITS(edge)  I2C0_HW_CONTROL_REG = (1 << USISIE) | (1 << USIOIE) | USI_HOLD_ON_ALL | (edge)
+
+
+/// \brief
+/// Aid for coding USI routines.
+/// \details
+/// Hand the transfer just finished over to `usi0_slave_transfer_done()`.
+#define USI0_SLAVE_TRANSFER_FINISHED    i2c0_slave.doneAddress = i2c0_slave.addressReceived; \
+                                        i2c0_slave.doneCount = i2c0_slave.count; \
+                                        i2c0_slave.done = ~0; \
+                                        i2c0_slave.state = USI0_SLAVE_IDLE
+#endif
+
+
 // \brief
 // Wait for transfer to finish.
 // \details
@@ -262,6 +526,14 @@ uint8_t usi0_wait_until_transfer_done_as_slave(uint8_t countOfEdges);
 void usi0_wait_until_bit_done_as_multimaster(void);
 
 
+#if defined I2C0_HW_RUNTIME_SPEED
+// \brief
+// Same as usi0_wait_until_bit_done_as_multimaster(), the SCL phases timed by
+// the delay loops calibrated by usi0_set_speed().
+void usi0_wait_until_bit_done_calibrated(void);
+#endif
+
+
 // =============================================================================
 // All AVR devices with USI receive their hardware definitions here.
 // =============================================================================
@@ -275,6 +547,17 @@ void usi0_wait_until_bit_done_as_multimaster(void);
 #   define I2C0_HW_CONTROL_REG          USICR
 #   define I2C0_HW_DATA_REG             USIDR
 #   define I2C0_HW_STATUS_REG           USISR
+#   define I2C0_HW_START_vect           USI_START_vect
+#   define I2C0_HW_OVERFLOW_vect        USI_OVERFLOW_vect
+#   define I2C0_HW_TIMER_MODE_REG       TCCR0A
+#   define I2C0_HW_TIMER_CLOCK_REG      TCCR0B
+#   define I2C0_HW_TIMER_COUNT_REG      TCNT0
+#   define I2C0_HW_TIMER_COMPARE_REG    OCR0A
+#   define I2C0_HW_TIMER_IRQ_MASK_REG   TIMSK
+#   define I2C0_HW_TIMER_IRQ_ENABLE_BIT OCIE0A
+#   define I2C0_HW_TIMER_IRQ_FLAG_REG   TIFR
+#   define I2C0_HW_TIMER_IRQ_FLAG_BIT   OCF0A
+#   define I2C0_HW_TIMER_COMPARE_vect   TIMER0_COMPA_vect
 
 #elif defined (__AVR_ATtiny26__)
 #   define I2C0_HW_PORT                 PORTB
@@ -285,6 +568,9 @@ void usi0_wait_until_bit_done_as_multimaster(void);
 #   define I2C0_HW_CONTROL_REG          USICR
 #   define I2C0_HW_DATA_REG             USIDR
 #   define I2C0_HW_STATUS_REG           USISR
+#   define I2C0_HW_START_vect           USI_STRT_vect
+#   define I2C0_HW_OVERFLOW_vect        USI_OVF_vect
+#   define I2C0_HW_NO_TIMER0_COMPARE
 
 #elif defined (__AVR_ATmega169__)
 #   define I2C0_HW_PORT                 PORTE
@@ -295,18 +581,73 @@ void usi0_wait_until_bit_done_as_multimaster(void);
 #   define I2C0_HW_CONTROL_REG          USICR
 #   define I2C0_HW_DATA_REG             USIDR
 #   define I2C0_HW_STATUS_REG           USISR
+#   define I2C0_HW_START_vect           USI_START_vect
+#   define I2C0_HW_OVERFLOW_vect        USI_OVERFLOW_vect
+#   define I2C0_HW_TIMER_MODE_REG       TCCR0A
+#   define I2C0_HW_TIMER_CLOCK_REG      TCCR0A
+#   define I2C0_HW_TIMER_COUNT_REG      TCNT0
+#   define I2C0_HW_TIMER_COMPARE_REG    OCR0A
+#   define I2C0_HW_TIMER_IRQ_MASK_REG   TIMSK0
+#   define I2C0_HW_TIMER_IRQ_ENABLE_BIT OCIE0A
+#   define I2C0_HW_TIMER_IRQ_FLAG_REG   TIFR0
+#   define I2C0_HW_TIMER_IRQ_FLAG_BIT   OCF0A
+#   define I2C0_HW_TIMER_COMPARE_vect   TIMER0_COMP_vect
 
 #else
 #   error "MCU type not known to i2c_hw_usi.h (or no MCU type defined at all)."
 #endif
 
 
+// =============================================================================
+// The bit and byte primitives. Their bodies live in
+// `i2c_hw_usi_primitives.h`, the lib file of the same name wraps the body
+// into the function. With `I2C0_HW_INLINE_PRIMITIVES` set the lib and the
+// application use the bodies, the files are void. Else the application
+// does not see them.
+// =============================================================================
+
+#if defined I2C0_HW_INLINE_PRIMITIVES
+#   define usi0_check4Error                         usi0_check4Error_inline
+#   define usi0_assert_stop_sequence                usi0_assert_stop_sequence_inline
+#   define usi0_wait_until_bit_done_as_multimaster  usi0_wait_until_bit_done_as_multimaster_inline
+#   define usi0_wait_until_bit_done_calibrated      usi0_wait_until_bit_done_calibrated_inline
+#   define usi0_send_byte_single_master             usi0_send_byte_single_master_inline
+#   define usi0_send_byte_multi_master              usi0_send_byte_multi_master_inline
+#   define usi0_receive_byte_any_master             usi0_receive_byte_any_master_inline
+#endif
+
+
+// One bit of a byte loop, `calibrated` as with USI0_LOW_PHASE_DELAY_OF().
+#if defined I2C0_HW_RUNTIME_SPEED
+#   define USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated)                  \
+    do                                                              \
+    {                                                               \
+        if (calibrated)                                             \
+            usi0_wait_until_bit_done_calibrated();                  \
+        else                                                        \
+            usi0_wait_until_bit_done_as_multimaster();              \
+    } while (0)
+#else
+#   define USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated)  usi0_wait_until_bit_done_as_multimaster()
+#endif
+
+
+#if defined I2C0_HW_INLINE_PRIMITIVES
+#   include "i2c_hw_usi_primitives.h"
+#endif
+
+
 // =============================================================================
 // Map implementation to standardized API.
 // =============================================================================
 
-#define hardI2c0_check4Error usi0_check4Error
+#if defined I2C0_HW_TIMER0_CLOCKED
+#   define hardI2c0_check4Error usi0_check4error_timer0_master
+enum I2C_FAILURE_type usi0_check4error_timer0_master(void);
+#else
+#   define hardI2c0_check4Error usi0_check4Error
 enum I2C_FAILURE_type usi0_check4Error(void);
+#endif
 
 
 #if defined I2C0_HW_AS_SLAVE
@@ -316,8 +657,13 @@ enum I2C_FAILURE_type usi0_check4Error(void);
 #            error "Single bus master addressable as slave is void - or by whom else can it be adressed?"
 #        else
 #            // opmode: multi master + slave
-#           define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master_slave()
+#           if defined I2C0_HW_RUNTIME_SPEED
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master_slave(p3,p4)
+void usi0_setup_master_slave(uint8_t bitrate, uint8_t prescaler);
+#           else
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master_slave()
 void usi0_setup_master_slave(void);
+#           endif
 #           define hardI2c0_putByteAsMaster      usi0_send_byte_multi_master
 void usi0_send_byte_multi_master(uint8_t dataByte);
 #           define hardI2c0_getByteAsMaster      usi0_receive_byte_any_master
@@ -337,6 +683,18 @@ uint8_t usi0_receive_byte_slave(uint8_t sendAck);
 #           define hardI2c0_setSlaveResponse     usi0_set_slave_response
 void usi0_set_slave_response(uint8_t on);
 #        endif
+#    elif defined I2C0_HW_INTERRUPT_DRIVEN
+#        // opmode: slave, interrupt driven
+#       define hardI2c0_init(p1,p2,p3,p4)        usi0_setup_slave_isr(p1, p2)
+void usi0_setup_slave_isr(uint8_t slaveAddress, uint8_t slaveMask);
+#       define hardI2c0_setSlaveBuffers          usi0_set_slave_buffers
+void usi0_set_slave_buffers(uint8_t *rxBuffer, uint8_t rxSize, uint8_t *txBuffer, uint8_t txSize);
+#       define hardI2c0_setSlaveRegisterFile     usi0_set_slave_register_file
+uint8_t usi0_set_slave_register_file(uint8_t *registers, uint8_t size);
+#       define hardI2c0_slaveTransferDone        usi0_slave_transfer_done
+uint8_t usi0_slave_transfer_done(uint8_t *addressReceived, uint8_t *byteCount);
+#       define hardI2c0_setSlaveResponse         usi0_set_slave_response
+void usi0_set_slave_response(uint8_t on);
 #    else
 #        // opmode: slave
 #       define hardI2c0_init(p1,p2,p3,p4)        usi0_setup_master_slave()
@@ -352,10 +710,31 @@ void usi0_set_slave_response(uint8_t on);
 #    endif
 #else
 #    if defined I2C0_HW_AS_MASTER
-#        if defined I2C0_HW_SINGLE_MASTER
+#        if defined I2C0_HW_SINGLE_MASTER && defined I2C0_HW_TIMER0_CLOCKED
+#            // opmode: single master, no slave, SCL clocked by Timer0
+#           if defined I2C0_HW_NO_TIMER0_COMPARE
+#               error "This MCU lacks a Timer0 compare match. Check your `I2C0_HW_TIMER0_CLOCKED` setting!"
+#           endif
+#           define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_timer0_master()
+void usi0_setup_timer0_master(void);
+#           define hardI2c0_putByteAsMaster      usi0_send_byte_timer0_master
+void usi0_send_byte_timer0_master(uint8_t dataByte);
+#           define hardI2c0_getByteAsMaster      usi0_receive_byte_timer0_master
+uint8_t usi0_receive_byte_timer0_master(uint8_t sendAck);
+#           define hardI2c0_openDevice           usi0_open_device_timer0_master
+enum I2C_FAILURE_type usi0_open_device_timer0_master(uint8_t deviceAddress);
+#           define hardI2c0_releaseBus           usi0_release_bus_timer0_master
+void usi0_release_bus_timer0_master(void);
+void usi0_assert_stop_sequence(void);
+#        elif defined I2C0_HW_SINGLE_MASTER
 #            // opmode: single master, no slave
-#           define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_single_master()
+#           if defined I2C0_HW_RUNTIME_SPEED
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_single_master(p3,p4)
+void usi0_setup_single_master(uint8_t bitrate, uint8_t prescaler);
+#           else
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_single_master()
 void usi0_setup_single_master(void);
+#           endif
 #           define hardI2c0_putByteAsMaster      usi0_send_byte_single_master
 void usi0_send_byte_single_master(uint8_t dataByte);
 #           define hardI2c0_getByteAsMaster      usi0_receive_byte_any_master
@@ -366,8 +745,13 @@ enum I2C_FAILURE_type usi0_open_device_single_master(uint8_t deviceAddress);
 void usi0_assert_stop_sequence(void);
 #        else
 #            // opmode: multi master, no slave
-#           define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master()
+#           if defined I2C0_HW_RUNTIME_SPEED
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master(p3,p4)
+void usi0_setup_master(uint8_t bitrate, uint8_t prescaler);
+#           else
+#               define hardI2c0_init(p1,p2,p3,p4)    usi0_setup_master()
 void usi0_setup_master(void);
+#           endif
 #           define hardI2c0_putByteAsMaster      usi0_send_byte_multi_master
 void usi0_send_byte_multi_master(uint8_t dataByte);
 #           define hardI2c0_getByteAsMaster      usi0_receive_byte_any_master
@@ -383,6 +767,61 @@ void usi0_assert_stop_sequence(void);
 #endif
 
 
+#if defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_MASTER
+#    error "Interrupt driven USI is available for slave only, see `I2C0_HW_TIMER0_CLOCKED` for the master. Check your `I2C0_HW_INTERRUPT_DRIVEN` and `I2C0_HW_AS_MASTER` settings!"
+#endif
+#if defined I2C0_HW_TIMER0_CLOCKED && (defined I2C0_HW_AS_SLAVE || !defined I2C0_HW_SINGLE_MASTER)
+#    error "Timer0 clocked USI is available for single master only. Check your `I2C0_HW_TIMER0_CLOCKED`, `I2C0_HW_SINGLE_MASTER` and `I2C0_HW_AS_SLAVE` settings!"
+#endif
+#if defined I2C0_HW_QUEUE_SIZE || defined I2C0_HW_CHAIN_TRANSACTIONS
+#    error "The transaction queue is available for the interrupt driven TWI master only. Check your `I2C0_HW_QUEUE_SIZE` and `I2C0_HW_CHAIN_TRANSACTIONS` settings!"
+#endif
+#if defined I2C0_HW_RUNTIME_SPEED
+#    if !defined I2C0_HW_AS_MASTER || defined I2C0_HW_TIMER0_CLOCKED
+#        error "The runtime bus speed is available for the USI masters clocked by software only. Check your `I2C0_HW_RUNTIME_SPEED`, `I2C0_HW_AS_MASTER` and `I2C0_HW_TIMER0_CLOCKED` settings!"
+#    endif
+#    define hardI2c0_setBusSpeed         usi0_set_speed
+void usi0_set_speed(uint8_t bitrate, uint8_t prescaler);
+#    define I2C0_BITRATE                 I2C0_BITRATE_OF(F_I2C0_HW)
+#    define I2C0_PRESCALER               I2C0_PRESCALER_OF(F_I2C0_HW)
+#endif
+#if defined I2C0_HW_SPEED_SLAVES
+#    error "Speed profiles need the bit rate generator of the TWI, the USI bus speed is fixed by `F_I2C0_HW`. Check your `I2C0_HW_SPEED_SLAVES` setting!"
+#endif
+#if defined I2C0_HW_TIMEOUT_TIMER1
+#    error "The Timer1 timeout bounds the waits of the TWI. Check your `I2C0_HW_TIMEOUT_TIMER1` setting!"
+#endif
+#if defined I2C0_HW_BUS_RECOVERY && (!defined I2C0_HW_AS_MASTER || defined I2C0_HW_TIMER0_CLOCKED)
+#    error "The bus gets recovered by the USI masters clocked by software only. Check your `I2C0_HW_BUS_RECOVERY`, `I2C0_HW_AS_MASTER` and `I2C0_HW_TIMER0_CLOCKED` settings!"
+#endif
+
+
+// =============================================================================
+// Map block and combined transfers to standardized API, any master mode.
+// =============================================================================
+
+#if defined I2C0_HW_AS_MASTER
+#    define hardI2c0_writeBlock          usi0_write_block
+enum I2C_FAILURE_type usi0_write_block(const uint8_t *buffer, uint16_t length);
+#    define hardI2c0_readBlock           usi0_read_block
+enum I2C_FAILURE_type usi0_read_block(uint8_t *buffer, uint16_t length);
+#    define hardI2c0_writeRead           i2c0_write_read
+enum I2C_FAILURE_type i2c0_write_read(uint8_t deviceAddress,
+                                      const uint8_t *writeBuffer,
+                                      uint16_t writeCount,
+                                      uint8_t *readBuffer,
+                                      uint16_t readCount);
+#    if !defined I2C0_HW_SINGLE_MASTER
+#        define hardI2c0_openDeviceRetry     i2c0_open_device_retry
+enum I2C_FAILURE_type i2c0_open_device_retry(uint8_t deviceAddress, void (*serveSlave)(void));
+#    endif
+#    if defined I2C0_HW_BUS_RECOVERY
+#        define hardI2c0_recoverBus          i2c0_recover_bus
+enum I2C_FAILURE_type i2c0_recover_bus(void);
+#    endif
+#endif
+
+
 #endif // I2C_HW_USI_H_INCLUDED
 
 
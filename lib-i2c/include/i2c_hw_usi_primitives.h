@@ -0,0 +1,294 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_hw_usi_primitives.h
+// Description : Bodies of the USI bit and byte primitives.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_hw_usi_primitives.h
+/// \brief
+/// Bodies of the USI bit and byte primitives.
+/// \details
+/// The lib file of the same name wraps a body into the function, the lib
+/// routines get this header by `i2c_lib_private.h`. The application gets
+/// it by `i2c_hw_usi.h` with `I2C0_HW_INLINE_PRIMITIVES` set only, along
+/// with `<avr/io.h>` and the failure code the bodies need.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_HW_USI_PRIMITIVES_H_INCLUDED
+#define I2C_HW_USI_PRIMITIVES_H_INCLUDED
+
+
+#include "i2c_hw_state.h"
+#include <avr/io.h>
+
+#if defined I2C0_HW_RUNTIME_SPEED
+// Volatile: loaded at each delay, so its cycles are known.
+extern volatile uint8_t i2c0_low_phase_loops;
+extern volatile uint16_t i2c0_high_phase_loops;
+#endif
+
+
+/// \brief
+/// Inline, always. The bodies are no functions of their own.
+#define USI0_INLINE                 static inline __attribute__((always_inline))
+
+
+#if !defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_check4Error()`.
+USI0_INLINE enum I2C_FAILURE_type usi0_check4Error_inline(void)
+{
+    return(i2c0_failure_info);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_assert_stop_sequence()`.
+USI0_INLINE void usi0_assert_stop_sequence_inline(void)
+{
+    USI0_PULL_SDA;
+    USI0_SDA_DRIVER_ENABLE;
+    USI0_LOW_PHASE_DELAY;
+    I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
+    USI0_RELEASE_SCL;
+    while(I2C0_SCL_IS_LOW) {}
+    USI0_HIGH_PHASE_DELAY;
+    USI0_SDA_DRIVER_DISABLE;
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_wait_until_bit_done_as_multimaster()` and
+/// `usi0_wait_until_bit_done_calibrated()`, `calibrated` is a constant.
+USI0_INLINE void usi0_wait_until_bit_done_timed_inline(uint8_t calibrated)
+{
+    USI0_LOW_PHASE_DELAY_OF(calibrated);
+    I2C0_HW_STATUS_REG = (1 << USIOIF) | (1 << USISIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+    USI0_RELEASE_SCL;
+    while (I2C0_SLAVE_NEEDS_TIME) {}
+    USI0_HIGH_PHASE_DELAY_OF(calibrated);
+    USI0_PULL_SCL;
+    if (I2C0_HW_STATUS_REG & (1 << USISIF))
+    {
+        i2c0_failure_info = I2C_PROTOCOL_FAIL | I2C_RESTARTED;
+        USI0_SDA_DRIVER_DISABLE;
+        I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
+        I2C0_HW_STATUS_REG = (1 << USIOIF) | (1 << USISIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+        USI0_RELEASE_SCL;
+        return;
+    }
+    if (I2C0_HW_STATUS_REG & (1 << USIPF))
+    {
+        i2c0_failure_info = I2C_PROTOCOL_FAIL | I2C_STOPPED;
+        USI0_SDA_DRIVER_DISABLE;
+        I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
+        I2C0_HW_STATUS_REG = (1 << USIOIF) | (1 << USISIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+        USI0_RELEASE_SCL;
+        return;
+    }
+}
+
+
+/// \brief
+/// Body of `usi0_wait_until_bit_done_as_multimaster()`.
+USI0_INLINE void usi0_wait_until_bit_done_as_multimaster_inline(void)
+{
+    usi0_wait_until_bit_done_timed_inline(0);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && defined I2C0_HW_RUNTIME_SPEED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_wait_until_bit_done_calibrated()`.
+USI0_INLINE void usi0_wait_until_bit_done_calibrated_inline(void)
+{
+    usi0_wait_until_bit_done_timed_inline(1);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && defined I2C0_HW_SINGLE_MASTER && !defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_send_byte_single_master()`, `calibrated` a constant as with
+/// `USI0_LOW_PHASE_DELAY_OF()`.
+// Send one byte as a bus master.
+// Sending out a byte is expected to receive an acknowledge!
+USI0_INLINE void usi0_send_byte_single_master_timed_inline(uint8_t dataByte, uint8_t calibrated)
+{
+    // Prepare data byte.
+    I2C0_HW_DATA_REG = dataByte;
+    USI0_SDA_DRIVER_ENABLE;
+    I2C0_HW_STATUS_REG = (1 << USIOIF) | 8;
+    // Do until counter overflow or bus error.
+    while (!(I2C0_HW_STATUS_REG & (1 << USIOIF)))
+    {
+        USI0_LOW_PHASE_DELAY_OF(calibrated);
+        USI0_RELEASE_SCL;
+        while(I2C0_SCL_IS_LOW) {}
+        // Check for bus contention.
+        if (I2C0_HW_STATUS_REG & ((1 << USISIF) | (1 << USIPF)))
+        {
+            // Turn off driver and retire.
+            USI0_SDA_DRIVER_DISABLE;
+            i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+            return;
+        }
+        USI0_HIGH_PHASE_DELAY_OF(calibrated);
+        USI0_PULL_SCL;
+        USI0_CLOCK_SHIFTER_ONCE;
+    }
+    USI0_SDA_DRIVER_DISABLE;
+    // Else check for ACK response.
+    USI0_LOW_PHASE_DELAY_OF(calibrated);
+    USI0_RELEASE_SCL;
+    while(I2C0_SCL_IS_LOW) {}
+    USI0_HIGH_PHASE_DELAY_OF(calibrated);
+    if (!I2C0_SDA_IS_LOW)
+        i2c0_failure_info |= I2C_NO_ACK;
+    USI0_PULL_SCL;
+}
+
+
+/// \brief
+/// Body of `usi0_send_byte_single_master()`.
+USI0_INLINE void usi0_send_byte_single_master_inline(uint8_t dataByte)
+{
+    if (USI0_PHASES_CALIBRATED)
+        usi0_send_byte_single_master_timed_inline(dataByte, 1);
+    else
+        usi0_send_byte_single_master_timed_inline(dataByte, 0);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_send_byte_multi_master()`, `calibrated` a constant as with
+/// `USI0_LOW_PHASE_DELAY_OF()`.
+// Send one byte as a bus master aware of additional master devices that might
+// need to arbitrate with. The problem is the USIDC that is assumed to show
+// only during the SCL high phase (the datasheet gives no evidence for sampling
+// during SCL '1' and holding while SCL '0'). The high phase might be shorter
+// than the time the SW takes to check it. So an alternate scheme is developped
+// to keep track with any bus contention even when the SW is a little bit
+// slower than the remote master!
+// The trick is to send the byte the same way a software master would send it
+// and have the hardware to sample the SDA and stretch SCL after every bit. SW
+// thus has plenty of time to check outgoing and received bit for collision
+// and react properly.
+// Sending out a byte is expected to receive an acknowledge!
+USI0_INLINE void usi0_send_byte_multi_master_timed_inline(uint8_t dataByte, uint8_t calibrated)
+{
+    // There is the old bit 7 still latched upon the next rising SCL edge.
+    // Countermeasure this latch and preload it with the new value also!
+    // According to the datasheet the latch is transparent when SW-CLK is
+    // selected. Thus the preloading is such simple.
+    I2C0_HW_CONTROL_REG = USI_HOLD_ON_ALL | USI_SHIFT_ON_SOFTWARE_COMMAND;
+    I2C0_HW_DATA_REG = 0xFF;
+    I2C0_HW_CONTROL_REG = USI_HOLD_ON_ALL | USI_SAMPLE_ON_FALLING_EDGE;
+    USI0_SDA_DRIVER_ENABLE;
+    for (uint8_t bitcount=0; bitcount<8; )
+    {
+        if (dataByte & 0x80)
+            USI0_RELEASE_SDA;
+        else
+            USI0_PULL_SDA;
+        USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated);
+        if (i2c0_failure_info & I2C_PROTOCOL_FAIL)
+            return;
+        bitcount++;
+        // check for collision; if shifter[7] is '1' then SDA also must have
+        // been '1' and is sampled in USI-Shifter[0]
+        if ((dataByte & 0x80) && (!(I2C0_HW_DATA_REG & 0x01)))
+        {   // arbitration lost: '1' sent but '0' was on SDA
+            // -> immediately retire from bus
+            USI0_SDA_DRIVER_DISABLE;
+            if (i2c0_failure_info & I2C_RESTARTED)
+            {
+                uint8_t bitedges = (bitcount << 1) & 0x0F;
+                if (bitedges)
+                    I2C0_HW_STATUS_REG = (1 << USIOIF) | bitedges;
+            }
+            else
+                I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
+            USI0_RELEASE_SCL;
+            i2c0_failure_info |= I2C_ARBITRATION_LOST;
+            return;
+        }
+        dataByte = dataByte << 1;
+    }
+    USI0_SDA_DRIVER_DISABLE;
+    i2c0_failure_info &= ~I2C_RESTARTED;
+    USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated);
+    if (i2c0_failure_info)
+        return;
+    if (I2C0_HW_DATA_REG & 0x01)
+        i2c0_failure_info |= I2C_NO_ACK;
+}
+
+
+/// \brief
+/// Body of `usi0_send_byte_multi_master()`.
+USI0_INLINE void usi0_send_byte_multi_master_inline(uint8_t dataByte)
+{
+    if (USI0_PHASES_CALIBRATED)
+        usi0_send_byte_multi_master_timed_inline(dataByte, 1);
+    else
+        usi0_send_byte_multi_master_timed_inline(dataByte, 0);
+}
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Body of `usi0_receive_byte_any_master()`, `calibrated` a constant as with
+/// `USI0_LOW_PHASE_DELAY_OF()`.
+USI0_INLINE uint8_t usi0_receive_byte_any_master_timed_inline(uint8_t transferFollows, uint8_t calibrated)
+{
+    USI0_SDA_DRIVER_DISABLE;
+    I2C0_HW_CONTROL_REG = USI_HOLD_ON_ALL | USI_SAMPLE_ON_FALLING_EDGE;
+    for (uint8_t bitcount=0; bitcount<8; bitcount++)
+    {
+        USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated);
+        if (i2c0_failure_info & I2C_PROTOCOL_FAIL)
+            return(0);
+    }
+    uint8_t dataByte = I2C0_HW_DATA_REG;
+    // Prepare ACK or NACK reply and send it.
+    if (transferFollows)
+    {
+        USI0_PULL_SDA;
+        USI0_SDA_DRIVER_ENABLE;
+    }
+    USI0_WAIT_UNTIL_BIT_DONE_OF(calibrated);
+    USI0_SDA_DRIVER_DISABLE;
+    if (!transferFollows && (!(I2C0_HW_DATA_REG & 0x01)))
+        i2c0_failure_info = I2C_ARBITRATION_LOST | I2C_NO_ACK;
+    return(dataByte);
+}
+
+
+/// \brief
+/// Body of `usi0_receive_byte_any_master()`.
+USI0_INLINE uint8_t usi0_receive_byte_any_master_inline(uint8_t transferFollows)
+{
+    if (USI0_PHASES_CALIBRATED)
+        return(usi0_receive_byte_any_master_timed_inline(transferFollows, 1));
+    return(usi0_receive_byte_any_master_timed_inline(transferFollows, 0));
+}
+#endif
+
+
+#endif // I2C_HW_USI_PRIMITIVES_H_INCLUDED
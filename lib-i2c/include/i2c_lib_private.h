@@ -19,6 +19,10 @@
 /// This file contains definitions for ease of I<SUP>2</SUP>C library subroutines
 /// programming, usage and code readability. This contents are not visible to
 /// the application (project).
+///
+/// The variables are declared here and defined once in `i2c0_hw_state.c`.
+/// The failure code and the slave acknowledge behaviour are declared in
+/// `i2c_hw_state.h`, shared with the primitives headers.
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -27,28 +31,168 @@
 
 
 #include "i2c_def.h"
+#include "i2c_hw_state.h"
 #include <inttypes.h>
 
 
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_SINGLE_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
 /// \brief
-/// Internal place to store the failure code(s).
-/// So far the original intention.
-/// To save RAM cells this has been redefined to serve as a status
-/// indication. So some codes are errors but others remain
-/// informative - or get errors in some but not all situations.
-/// See `i2c_def.h` for details about status codes.
-enum I2C_FAILURE_type i2c0_failure_info;
+/// Internal state of the random backoff, see `i2c0_open_device_retry()`.
+/// \note
+/// This RAM byte is occupied only when a multi master mode is enabled.
+extern uint8_t i2c0_backoff_state;
+#endif
+
+
+/// \brief
+/// Next state of the backoff random numbers, a Galois LFSR of the
+/// polynomial x^8 + x^6 + x^5 + x^4 + 1. Runs through all 255 states
+/// but 0.
+#define I2C0_BACKOFF_NEXT(state)    ((uint8_t)(((state) >> 1) ^ (((state) & 0x01) ? 0xB8 : 0x00)))
+
+
+#if defined I2C0_HW_SPEED_SLAVES || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Speed profile assigned to a slave by `twi0_set_slave_speed()`.
+struct I2C0_SLAVE_SPEED_type
+{
+    uint8_t address;        ///< Address field, R/W-flag 0. 0 marks a free entry.
+    uint8_t profile;        ///< One of `I2C0_SPEED_DEFAULT`, `I2C0_SPEED_100k` ...
+};
+
+
+/// \brief
+/// Slaves with a speed profile of their own.
+/// \note
+/// This RAM is occupied only when `I2C0_HW_SPEED_SLAVES` is defined.
+extern struct I2C0_SLAVE_SPEED_type i2c0_slave_speed[I2C0_HW_SPEED_SLAVES];
+
+
+/// \brief
+/// Speed profile the bit rate generator runs at, `I2C0_SPEED_UNKNOWN`
+/// after `hardI2c0_init()`.
+extern uint8_t i2c0_speed_profile;
+
+#define I2C0_SPEED_UNKNOWN          0xFF
+#endif
+
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_MASTER || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Layout of the transaction processed by the interrupt driven master.
+struct I2C0_TRANSACTION_type
+{
+    uint8_t deviceAddress;  ///< Address field incl. R/W-flag of the next (RE)START.
+    uint8_t *writeBuffer;   ///< Next byte to send to the slave.
+    uint16_t writeCount;    ///< Bytes still to send.
+    uint8_t *readBuffer;    ///< Next place to store a byte read from the slave.
+    uint16_t readCount;     ///< Bytes still to read.
+    struct I2C_STATUS_type *status; ///< Status record of the transaction.
+};
+
+
+/// \brief
+/// Internal place to store the transaction currently processed by the
+/// interrupt driven master.
+/// \note
+/// This RAM is occupied only when the interrupt driven master mode is
+/// enabled. Shared between the application and the TWI interrupt, thus
+/// `volatile`.
+extern volatile struct I2C0_TRANSACTION_type i2c0_transaction;
 
 
-#if defined I2C0_HW_AS_SLAVE || defined DOXYGEN_DOCU_IS_GENERATED
 /// \brief
-/// Internal place to store slave acknowledge behaviour.
+/// Internal status record of the transactions submitted by
+/// `twi0_start_transaction()`.
 /// \note
-/// This RAM byte is occupied only when a slave mode is enabled.
-/// This variable is void if solely a master mode is selected.
-uint8_t slaveAckControl;
-#else
-   #define slaveAckControl 0
+/// This RAM is occupied only when the interrupt driven master mode is
+/// enabled.
+extern struct I2C_STATUS_type i2c0_status;
+
+
+#if defined I2C0_HW_QUEUE_SIZE || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Internal ring of the transactions queued for the interrupt driven
+/// master.
+/// \details
+/// Single producer (application), single consumer (TWI interrupt). The
+/// application fills the slot at `i2c0_queue_head` and then advances
+/// the head, the interrupt advances `i2c0_queue_tail` past a finished
+/// transaction. Each index is written by one side only and is a single
+/// byte, so neither side needs to disable interrupts. The slot at the
+/// tail is the transaction running.
+/// \note
+/// This RAM is occupied only when `I2C0_HW_QUEUE_SIZE` is set.
+extern volatile struct I2C0_TRANSACTION_type i2c0_queue[I2C0_HW_QUEUE_SIZE];
+
+
+/// \brief
+/// Next free slot of `i2c0_queue`, written by the application only.
+extern volatile uint8_t i2c0_queue_head;
+
+
+/// \brief
+/// Slot of `i2c0_queue` running, written by the interrupt only.
+extern volatile uint8_t i2c0_queue_tail;
+#endif
+#endif
+
+
+#if defined I2C0_HW_TIMER0_CLOCKED || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Internal place to store the state of the Timer0 clocked USI master.
+/// \note
+/// This RAM byte is occupied only when the Timer0 clocked mode is enabled.
+/// See `USI0_TIMER0_STATE_type` for the states.
+extern volatile uint8_t i2c0_bit_engine_state;
+
+
+/// \brief
+/// Internal place to store the byte received by the Timer0 clocked USI
+/// master.
+/// \note
+/// This RAM byte is occupied only when the Timer0 clocked mode is enabled.
+extern volatile uint8_t i2c0_received_byte;
+#endif
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_SLAVE || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Layout of the state of the interrupt driven slave.
+struct I2C0_SLAVE_type
+{
+    uint8_t address;            ///< Assigned (base) address.
+    uint8_t mask;               ///< Address bits set are 'don't care', bit 0 enables general call.
+    uint8_t state;              ///< Bus state, USI see hardware header, TWI !=0 in transfer.
+    uint8_t addressReceived;    ///< Address field of the transfer in progress.
+    uint8_t count;              ///< Bytes moved by the transfer in progress.
+    uint8_t *rxBuffer;          ///< Receives the bytes written by a master.
+    uint8_t rxSize;             ///< Size of `rxBuffer`.
+    uint8_t *txBuffer;          ///< Holds the bytes read by a master.
+    uint8_t txSize;             ///< Size of `txBuffer`.
+    uint8_t registerFile;       ///< Set if the buffers form a register file.
+    uint8_t pointer;            ///< Register file pointer, kept between transfers.
+    uint8_t pointerReceived;    ///< Set once the write access has set the pointer.
+    uint8_t done;               ///< Set when a transfer has finished.
+    uint8_t doneAddress;        ///< Address field of the finished transfer.
+    uint8_t doneCount;          ///< Bytes moved by the finished transfer.
+};
+
+
+/// \brief
+/// Internal place to store the state of the interrupt driven slave.
+/// \note
+/// This RAM is occupied only when the interrupt driven slave mode is
+/// enabled. Shared between the application and the interrupts, thus
+/// `volatile`.
+extern volatile struct I2C0_SLAVE_type i2c0_slave;
+#endif
+
+
+// The bodies of the primitives, see `i2c_hw_twi.h` and `i2c_hw_usi.h`.
+#if defined I2C_HW_TWI_H_INCLUDED
+#   include "i2c_hw_twi_primitives.h"
+#elif defined I2C_HW_USI_H_INCLUDED
+#   include "i2c_hw_usi_primitives.h"
 #endif
 
 #endif // I2C_LIB_PRIVATE_H_INCLUDED
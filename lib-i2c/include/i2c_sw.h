@@ -67,6 +67,14 @@
 ///  + `I2C_SW_EMERGENCY_TIMEOUT_us` is used to return in case the bus blocks.
 ///  + `F_I2C_SW` defines the maximum bus frequency.
 ///
+/// `I2C_SW_BUS_RECOVERY` adds `softI2c_recoverBus()`. It is called by
+/// `softI2c_init()` and `softI2c_openDevice()` if a slave keeps SDA low.
+///
+/// The bit timing is counted in CPU cycles, so `F_I2C_SW` holds up to
+/// 400 kHz if `F_CPU` is high enough (about 8 MHz). If your compiler
+/// generates slower bit loops tell by `I2C_SW_LOW_PHASE_OVERHEAD_CYCLES`
+/// and `I2C_SW_HIGH_PHASE_OVERHEAD_CYCLES`.
+///
 /// Those definitions can be done in a dedicated project header or in the
 /// makefile.
 /// The latter one is prefered for its more centralized status and higher
@@ -139,6 +147,8 @@
 /// The intended IO-lines are set up to form the open-drain drivers of the SCL
 /// and SDA bus lines.
 /// A 'STOP' condition is sent to clean up possible power up artefacts.
+/// With `I2C_SW_BUS_RECOVERY` a slave still keeping SDA low gets clocked
+/// out, see `softI2c_recoverBus()`.
 ///
 /// If the bus can not be setup properly a failure code will be dropped.
 /// This failure code can be checked by calling `softI2c_check4Error()`.
@@ -182,6 +192,8 @@ uint8_t softI2c_getByte(uint8_t sendAck);
 /// will send an 'ACK'.
 /// As this starts accessing a dedicated slave the failure code(s) of previous
 /// accesses are cleared.
+/// With `I2C_SW_BUS_RECOVERY` the bus gets recovered first if a slave keeps
+/// SDA low, see `softI2c_recoverBus()`.
 /// The intended typical usage is to address a slave for read or write access and
 /// check that it is available. A code example might be like this:
 /// \code
@@ -240,10 +252,68 @@ void softI2c_releaseBus(void);
 enum I2C_FAILURE_type softI2c_check4Error(void);
 
 
-// Higher level of communication to a device. Address it, read/write
-// 'messageSize' byte to/from 'buffer_p'.
-// File: i2c_sw_access.c
-//I2C_FAILURE_type softI2c_accessDevice(uint8_t address, uint8_t *buffer_p, uint16_t messageSize);
+/// \brief
+/// Puts a block of bytes to the bus. Returns its status.
+/// \details
+/// `length` bytes of `buffer` are sent to the already addressed slave.
+/// The transfer stops at the first byte not acknowledged by the slave or
+/// at any other failure.
+/// \param buffer holds the bytes to send.
+/// \param length number of bytes to send.
+/// \returns
+/// Status of the transfer.
+/// \sa softI2c_openDevice()
+enum I2C_FAILURE_type softI2c_writeBlock(const uint8_t *buffer, uint16_t length);
+
+
+/// \brief
+/// Reads a block of bytes from the bus. Returns its status.
+/// \details
+/// `length` bytes are read from the already addressed slave into `buffer`.
+/// All bytes but the last one are answered by an 'ACK', the last one by
+/// a 'NACK'.
+/// The transfer stops at any failure.
+/// \param buffer receives the bytes read.
+/// \param length number of bytes to read.
+/// \returns
+/// Status of the transfer.
+/// \sa softI2c_openDevice()
+enum I2C_FAILURE_type softI2c_readBlock(uint8_t *buffer, uint16_t length);
+
+
+/// \brief
+/// Higher level of communication to a device. Returns its status.
+/// \details
+/// Addresses the slave, reads or writes `messageSize` bytes from/to
+/// `buffer_p` - depending on the R/W-flag of `address` - and releases the
+/// bus again.
+/// \code
+/// uint8_t data[4];
+/// if (softI2c_accessDevice(I2C_EEPROM | I2C_READ_ACCESS, data, sizeof(data)))
+///    ... // code executed when bus access not successful
+/// \endcode
+/// \param address field of the desired slave including also the R/W-flag.
+/// \param buffer_p holds the bytes to send or receives the bytes read.
+/// \param messageSize number of bytes to transfer.
+/// \returns
+/// Status of access.
+enum I2C_FAILURE_type softI2c_accessDevice(uint8_t address, uint8_t *buffer_p, uint16_t messageSize);
+
+
+#if defined I2C_SW_BUS_RECOVERY || defined DOXYGEN_DOCU_IS_GENERATED
+/// \brief
+/// Frees the bus from a slave keeping SDA low. Returns its status.
+/// \details
+/// A slave reset or disturbed within a byte keeps on driving its bit to
+/// SDA, waiting for the clock. SCL is clocked up to 9 times until the
+/// slave releases SDA, then the 'STOP' is sent. The slave sees a 'NACK'
+/// at the end of its byte and is idle again.
+/// Needs `I2C_SW_BUS_RECOVERY`.
+/// \returns
+/// `I2C_SUCCESS` if the bus is free again, `I2C_SDA_BLOCKED` if the slave
+/// keeps SDA low, `I2C_TIMED_OUT` if SCL is kept low.
+enum I2C_FAILURE_type softI2c_recoverBus(void);
+#endif
 
 
 #endif // I2C_SW_H_INCLUDED
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_sw_instance.h
+// Description : Several software emulated masters from one i2c_sw.c.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_sw_instance.h
+/// \brief
+/// Include this for more than one software emulated bus master.
+/// \details
+/// Each instance `n` gets its own set of functions, `softI2c<n>_init()`
+/// up to `softI2c<n>_check4Error()`, with its own failure code. The
+/// pins of each instance stay compile time constants, so the bit access
+/// still compiles into single sbi/cbi/sbis instructions.
+///
+/// An instance is made by a small source file of your project which
+/// sets the number and the identifiers required by `i2c_sw.h`, then
+/// includes `i2c_sw.c` (add the lib's source folder to the include
+/// path):
+/// \code
+/// // soft_bus1.c
+/// #define I2C_SW_INSTANCE         1
+/// #define I2C_SW_SDA_PORT         PORTB
+/// #define I2C_SW_SDA_DDR          DDRB
+/// #define I2C_SW_SDA_READBACK     PINB
+/// #define I2C_SW_SDA_BIT          0
+/// #define I2C_SW_SDA_BITPOS       (1 << I2C_SW_SDA_BIT)
+/// #define I2C_SW_SCL_PORT         PORTB
+/// #define I2C_SW_SCL_DDR          DDRB
+/// #define I2C_SW_SCL_READBACK     PINB
+/// #define I2C_SW_SCL_BIT          1
+/// #define I2C_SW_SCL_BITPOS       (1 << I2C_SW_SCL_BIT)
+/// #include "i2c_sw.c"
+/// \endcode
+/// The application declares the instances it uses:
+/// \code
+/// #include "i2c_sw_instance.h"
+/// I2C_SW_DECLARE_INSTANCE(1)
+/// I2C_SW_DECLARE_INSTANCE(2)
+/// ...
+/// if (!softI2c2_openDevice(SENSOR))
+/// \endcode
+/// Bus frequency and timeout may be set per instance file as well. The
+/// single instance of `i2c_sw.h` with its `softI2c_*()` functions is
+/// still available beside them.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_SW_INSTANCE_H_INCLUDED
+#define I2C_SW_INSTANCE_H_INCLUDED
+
+
+#include <inttypes.h>
+#include "i2c_def.h"
+
+
+/// \brief
+/// Name of function `name` of instance `n`.
+#define I2C_SW_INSTANCE_PASTE(n, name)      softI2c ## n ## _ ## name
+#define I2C_SW_INSTANCE_NAME(n, name)       I2C_SW_INSTANCE_PASTE(n, name)
+
+
+/// \brief
+/// Declares the functions of instance `n`, see `i2c_sw.h` for their
+/// description.
+#define I2C_SW_DECLARE_INSTANCE(n)                                                              \
+    void I2C_SW_INSTANCE_NAME(n, init)(void);                                                   \
+    void I2C_SW_INSTANCE_NAME(n, putByte)(uint8_t dataByte);                                    \
+    uint8_t I2C_SW_INSTANCE_NAME(n, getByte)(uint8_t sendAck);                                  \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, openDevice)(uint8_t address);                 \
+    void I2C_SW_INSTANCE_NAME(n, releaseBus)(void);                                             \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, check4Error)(void);                           \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, writeBlock)(const uint8_t *buffer, uint16_t length); \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, readBlock)(uint8_t *buffer, uint16_t length); \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, accessDevice)(uint8_t address, uint8_t *buffer_p, uint16_t messageSize); \
+    enum I2C_FAILURE_type I2C_SW_INSTANCE_NAME(n, recoverBus)(void);
+
+
+// =============================================================================
+// Compiling an instance: i2c_sw.c includes this header first if
+// I2C_SW_INSTANCE is set, so all of its names get the instance number.
+// =============================================================================
+
+#if defined I2C_SW_INSTANCE
+#   define softI2c_init                 I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, init)
+#   define softI2c_putByte              I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, putByte)
+#   define softI2c_getByte              I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, getByte)
+#   define softI2c_openDevice           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, openDevice)
+#   define softI2c_releaseBus           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, releaseBus)
+#   define softI2c_check4Error          I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, check4Error)
+#   define softI2c_writeBlock           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, writeBlock)
+#   define softI2c_readBlock            I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, readBlock)
+#   define softI2c_accessDevice         I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, accessDevice)
+#   define softI2c_recoverBus           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, recoverBus)
+#   define softI2c_failure_info         I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, failure_info)
+#   define softI2c_waitHalfBitTime      I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, waitHalfBitTime)
+#   define softI2c_releaseScl           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, releaseScl)
+#   define softI2c_releaseSda           I2C_SW_INSTANCE_NAME(I2C_SW_INSTANCE, releaseSda)
+#endif
+
+
+#endif // I2C_SW_INSTANCE_H_INCLUDED
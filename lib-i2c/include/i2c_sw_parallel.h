@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_sw_parallel.h
+// Description : Software emulated master driving up to 8 buses at once.
+//               These identifiers need to be defined already for the library
+//               routines to work:
+//                  I2C_PAR_SDA_PORT
+//                  I2C_PAR_SDA_DDR
+//                  I2C_PAR_SDA_READBACK
+//                  I2C_PAR_SDA_MASK
+//                  I2C_PAR_SCL_PORT
+//                  I2C_PAR_SCL_DDR
+//                  I2C_PAR_SCL_READBACK
+//                  I2C_PAR_SCL_BITPOS
+//               These identifiers are also recommended to be set already but
+//               they get adjusted to default values if missing:
+//                  I2C_PAR_EMERGENCY_TIMEOUT_us
+//                  F_I2C_PAR
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_sw_parallel.h
+/// \brief
+/// Include this for a software emulated master on up to 8 buses in parallel.
+/// \details
+/// Some boards carry identical slaves with one fixed address on separate
+/// buses. This master shares one SCL line among all of them and gives
+/// each bus its own SDA line, all SDA lines on the same port. The buses
+/// are clocked together: each bit takes one write to the SDA port and one
+/// read of its readback, so all slaves are accessed in the time of one.
+///
+/// Bus `n` is the one with SDA on port bit `n`. Functions transferring
+/// individual bytes take an array of 8 bytes indexed by `n`, entries of
+/// bits not in `I2C_PAR_SDA_MASK` are left alone. Acknowledges are
+/// returned as bitmaps in the same layout, a set bit tells the slave on
+/// this bus did send 'ACK'.
+///
+/// You must tell the make tool to compile the `i2c_sw_parallel.c` file in
+/// addition to your own project source files.
+///
+/// These identifiers need to be defined already for the library routines to
+/// compile:
+///  + `I2C_PAR_SDA_PORT` defines the port all SDA lines are connected to
+///    (e.g. PORTB).
+///  + `I2C_PAR_SDA_DDR` defines the data direction control of this port
+///    (e.g. DDRB).
+///  + `I2C_PAR_SDA_READBACK` defines the IO status readback of this port
+///    (e.g. PINB).
+///  + `I2C_PAR_SDA_MASK` defines the port bits used as SDA (e.g. 0x0F for
+///    four buses on bits 0 to 3).
+///  + `I2C_PAR_SCL_PORT`, `I2C_PAR_SCL_DDR`, `I2C_PAR_SCL_READBACK` and
+///    `I2C_PAR_SCL_BITPOS` define the common SCL line like with `i2c_sw.h`.
+///  + `F_CPU` defines the operating frequency of the CPU and must be set to its
+///    corrected value. The bus speed depends on this definition.
+///
+/// These identifiers are also recommended to be set but they get adjusted to
+/// default values if missing. A warning message is asserted in this case:
+///  + `I2C_PAR_EMERGENCY_TIMEOUT_us` is used to return in case SCL blocks.
+///  + `F_I2C_PAR` defines the maximum bus frequency.
+///
+/// The bit timing is counted in CPU cycles like with `i2c_sw.h`. If your
+/// compiler generates slower bit loops tell by
+/// `I2C_PAR_LOW_PHASE_OVERHEAD_CYCLES` and `I2C_PAR_HIGH_PHASE_OVERHEAD_CYCLES`.
+///
+/// Other bits of the SDA data direction register must not be changed by
+/// interrupt routines while a transfer is on its way.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_SW_PARALLEL_H_INCLUDED
+#define I2C_SW_PARALLEL_H_INCLUDED
+
+
+#include <inttypes.h>
+#include "i2c_def.h"
+
+
+/// \brief
+/// Default bus operating frequency. The unit is Hz (Hertz).
+#ifndef F_I2C_PAR
+#   define F_I2C_PAR 100000UL
+#   warning "'F_I2C_PAR' found undefined. Now defaults to 100kHz."
+#endif
+
+
+/// \brief
+/// Default timeout to prevent hangups on SCL contention. The unit is us (microseconds).
+#ifndef I2C_PAR_EMERGENCY_TIMEOUT_us
+#   define I2C_PAR_EMERGENCY_TIMEOUT_us 20000UL
+#   warning "'I2C_PAR_EMERGENCY_TIMEOUT_us' found undefined. Now defaults to 20ms."
+#endif
+
+
+/// \brief
+/// Initializes the IO-lines and the buses.
+/// \details
+/// A 'STOP' condition is sent on all buses to clean up possible power up
+/// artefacts.
+void parI2c_init(void);
+
+
+/// \brief
+/// Addresses the slaves on all buses.
+/// \details
+/// A 'START' sequence is given on all buses, then the same address field
+/// is sent to all of them. The failure code(s) of previous accesses are
+/// cleared.
+/// \param address field of the desired slaves including also the R/W-flag.
+/// \returns
+/// Bitmap of the buses whose slave did send 'ACK'.
+uint8_t parI2c_openDevice(uint8_t address);
+
+
+/// \brief
+/// Puts the same byte to all buses.
+/// \param dataByte to be sent to the slaves.
+/// \returns
+/// Bitmap of the buses whose slave did send 'ACK'.
+uint8_t parI2c_putByte(uint8_t dataByte);
+
+
+/// \brief
+/// Puts one byte to each bus.
+/// \param dataBytes holds 8 bytes, `dataBytes[n]` is sent to bus `n`.
+/// \returns
+/// Bitmap of the buses whose slave did send 'ACK'.
+uint8_t parI2c_putBytes(const uint8_t *dataBytes);
+
+
+/// \brief
+/// Reads one byte from each bus.
+/// \param dataBytes receives 8 bytes, `dataBytes[n]` from bus `n`.
+/// \param sendAck will enable sending an 'ACK' to all buses if set (!=0).
+void parI2c_getBytes(uint8_t *dataBytes, uint8_t sendAck);
+
+
+/// \brief
+/// Releases all buses by sending the 'STOP' sequence.
+void parI2c_releaseBus(void);
+
+
+/// \brief
+/// Reports the bus failure code(s) of the last access.
+/// \details
+/// Missing acknowledges are not reported here but by the bitmaps of the
+/// transfer functions, since they are a matter of each bus.
+/// \returns
+/// Failure code(s), `I2C_SUCCESS` if none.
+enum I2C_FAILURE_type parI2c_check4Error(void);
+
+
+#endif // I2C_SW_PARALLEL_H_INCLUDED
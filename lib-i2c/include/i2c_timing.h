@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_timing.h
+// Description : Bit timing of the masters clocked by software.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_timing.h
+/// \brief
+/// Bit timing of the masters clocked by software.
+/// \details
+/// The SCL phases and the clock stretch polling in CPU cycles, for the
+/// software master of `i2c_sw.c`, the parallel master of
+/// `i2c_sw_parallel.c` and the USI master of `i2c_hw_usi.h` alike. Each
+/// takes its bus frequency `f_bus` in Hz and its timeout `timeout_us` in
+/// us, `F_CPU` has to be set. All of them are constant expressions, to be
+/// used by `#if` as well.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef I2C_TIMING_H_INCLUDED
+#define I2C_TIMING_H_INCLUDED
+
+
+/// \brief
+/// CPU cycles of one bit time at the bus frequency `f_bus`.
+#define I2C_BIT_CYCLES(f_bus)               ((F_CPU + (f_bus) / 2) / (f_bus))
+
+
+/// \brief
+/// Minimum SCL low time in CPU cycles according to the bus specification.
+/// \details
+/// t<SUB>LOW</SUB> is 4.7 us in standard mode and 1.3 us in fast mode.
+/// With fast mode t<SUB>LOW</SUB> is longer than half of the bit time.
+#define I2C_MIN_LOW_CYCLES_FAST             ((F_CPU * 13UL + 9999999UL) / 10000000UL)
+#define I2C_MIN_LOW_CYCLES_STANDARD         ((F_CPU * 47UL + 9999999UL) / 10000000UL)
+#define I2C_MIN_LOW_CYCLES(f_bus)           ((f_bus) > 100000UL ? I2C_MIN_LOW_CYCLES_FAST : \
+                                                                  I2C_MIN_LOW_CYCLES_STANDARD)
+
+
+/// \brief
+/// Minimum SCL high time in CPU cycles according to the bus specification.
+/// \details
+/// t<SUB>HIGH</SUB> is 4.0 us in standard mode and 0.6 us in fast mode.
+#define I2C_MIN_HIGH_CYCLES_FAST            ((F_CPU * 6UL + 9999999UL) / 10000000UL)
+#define I2C_MIN_HIGH_CYCLES_STANDARD        ((F_CPU * 4UL + 999999UL) / 1000000UL)
+
+
+/// \brief
+/// CPU cycles of the SCL low phase at `f_bus`, half of the bit time but
+/// t<SUB>LOW</SUB> at least.
+#define I2C_LOW_PHASE_CYCLES(f_bus)         (((I2C_BIT_CYCLES(f_bus) + 1) / 2) > I2C_MIN_LOW_CYCLES(f_bus) ? \
+                                             ((I2C_BIT_CYCLES(f_bus) + 1) / 2) : I2C_MIN_LOW_CYCLES(f_bus))
+
+
+/// \brief
+/// CPU cycles of the SCL high phase at `f_bus`, the rest of the bit time.
+#define I2C_HIGH_PHASE_CYCLES(f_bus)        (I2C_BIT_CYCLES(f_bus) > I2C_LOW_PHASE_CYCLES(f_bus) ? \
+                                             I2C_BIT_CYCLES(f_bus) - I2C_LOW_PHASE_CYCLES(f_bus) : 0)
+
+
+/// \brief
+/// Waits `cycles` CPU cycles less the already spent `overhead`.
+#define I2C_DELAY_REMAINING_CYCLES(cycles, overhead) \
+    __builtin_avr_delay_cycles(((cycles) > (overhead)) ? ((cycles) - (overhead)) : 0)
+
+
+/// \brief
+/// CPU cycles of the timeout `timeout_us`.
+#define I2C_TIMEOUT_CYCLES(timeout_us)      ((timeout_us) * (F_CPU / 1000000UL))
+
+
+/// \brief
+/// CPU cycles of one turn of the SCL stretch polling.
+/// \details
+/// Just the 6 cycles of the loop itself, unless the timeout would
+/// overflow the 16 bit poll counter.
+#define I2C_STRETCH_POLL_CYCLES(timeout_us) ((I2C_TIMEOUT_CYCLES(timeout_us) / 6) < 65535UL ? 6 : \
+                                             (I2C_TIMEOUT_CYCLES(timeout_us) / 65535UL + 1))
+
+
+/// \brief
+/// Turns of the SCL stretch polling until `timeout_us` is up.
+#define I2C_STRETCH_POLLS(timeout_us)       (I2C_TIMEOUT_CYCLES(timeout_us) / I2C_STRETCH_POLL_CYCLES(timeout_us))
+
+
+#endif // I2C_TIMING_H_INCLUDED
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c0_hw_state.c
+// Description : The variables of the lib, defined once.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c0_hw_state.c
+/// \brief
+/// Definition of the variables declared in `i2c_lib_private.h` and
+/// `i2c_hw_state.h`.
+/// \details
+/// Serves TWI and USI alike. Each variable exists only in the operation
+/// modes which use it. Add this file to the project together with the
+/// other files of the lib.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined (I2C_HW_TWI_H_INCLUDED) || defined (I2C_HW_USI_H_INCLUDED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+
+
+#if !defined I2C0_HW_FAILURE_REG
+#   if defined I2C0_HW_INTERRUPT_DRIVEN || defined I2C0_HW_TIMER0_CLOCKED
+volatile enum I2C_FAILURE_type i2c0_failure_info;
+#   else
+enum I2C_FAILURE_type i2c0_failure_info;
+#   endif
+#endif
+
+
+#if defined I2C0_HW_AS_SLAVE
+uint8_t slaveAckControl;
+#endif
+
+
+#if defined I2C0_HW_AS_MASTER && !defined I2C0_HW_SINGLE_MASTER
+uint8_t i2c0_backoff_state = I2C0_HW_BACKOFF_SEED;
+#endif
+
+
+#if defined I2C0_HW_SPEED_SLAVES
+struct I2C0_SLAVE_SPEED_type i2c0_slave_speed[I2C0_HW_SPEED_SLAVES];
+uint8_t i2c0_speed_profile = I2C0_SPEED_UNKNOWN;
+#endif
+
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_MASTER
+volatile struct I2C0_TRANSACTION_type i2c0_transaction;
+struct I2C_STATUS_type i2c0_status;
+#endif
+
+
+#if defined I2C0_HW_QUEUE_SIZE
+volatile struct I2C0_TRANSACTION_type i2c0_queue[I2C0_HW_QUEUE_SIZE];
+volatile uint8_t i2c0_queue_head;
+volatile uint8_t i2c0_queue_tail;
+#endif
+
+
+#if defined I2C0_HW_RUNTIME_SPEED
+volatile uint8_t i2c0_low_phase_loops;
+volatile uint16_t i2c0_high_phase_loops;
+#endif
+
+
+#if defined I2C0_HW_TIMER0_CLOCKED
+volatile uint8_t i2c0_bit_engine_state;
+volatile uint8_t i2c0_received_byte;
+#endif
+
+
+#if defined I2C0_HW_INTERRUPT_DRIVEN && defined I2C0_HW_AS_SLAVE
+volatile struct I2C0_SLAVE_type i2c0_slave;
+#endif
+
+
+#endif /* defined (I2C_HW_TWI_H_INCLUDED) || defined (I2C_HW_USI_H_INCLUDED) */
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c0_open_device_retry.c
+// Description : Open a device, retried with backoff after lost arbitration.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c0_open_device_retry.c
+/// \brief  Retry policy of the multi master modes on top of
+/// `hardI2c0_openDevice()`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <util/delay.h>
+
+/// \brief
+/// Start access to a certain slave, retried after a lost arbitration.
+/// Valid for any multi master bus mode.
+/// \details
+/// Calls `hardI2c0_openDevice()` up to `I2C0_HW_RETRY_ATTEMPTS` times.
+/// After each lost arbitration the master backs off for a random number
+/// of slots, drawn from a window which doubles with each attempt up to
+/// `I2C0_HW_BACKOFF_WINDOW` slots. The random numbers come from
+/// `i2c0_backoff_state`, seeded by `I2C0_HW_BACKOFF_SEED`.
+/// `serveSlave` is called once per slot, it serves the remote master
+/// which has won the arbitration and addresses this device.
+/// Dedicated to TWI and USI equipped devices.
+/// \param deviceAddress defines which slave to access. It shall
+/// define the READ or WRITE mode also.
+/// \param serveSlave handles a slave access pending, may be 0.
+/// \returns failure code according to `I2C_FAILURE_type` of the last
+/// attempt. See `i2c_def.h`
+enum I2C_FAILURE_type i2c0_open_device_retry(uint8_t deviceAddress, void (*serveSlave)(void))
+{
+    enum I2C_FAILURE_type failure;
+    uint8_t attempts = I2C0_HW_RETRY_ATTEMPTS;
+    uint8_t window = 1;
+    uint8_t slots;
+
+    for (;;)
+    {
+        failure = hardI2c0_openDevice(deviceAddress);
+        if (!(failure & (I2C_ARBITRATION_LOST | I2C_RESTARTED)) || !--attempts)
+            return(failure);
+        i2c0_backoff_state = I2C0_BACKOFF_NEXT(i2c0_backoff_state);
+        slots = i2c0_backoff_state & (window - 1);
+        if (window < I2C0_HW_BACKOFF_WINDOW)
+            window <<= 1;
+        do
+        {
+            if (serveSlave)
+                serveSlave();
+            _delay_us(I2C0_HW_BACKOFF_SLOT_us);
+        } while (slots--);
+    }
+}
+
+
+#endif /* (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) */
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c0_recover_bus.c
+// Description : Clock a slave out which keeps SDA low, then STOP.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c0_recover_bus.c
+/// \brief  Bus recovery of the blocking masters, TWI and USI alike.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_BUS_RECOVERY) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <util/delay.h>
+
+
+// Half a bit time of the recovery clocks. Standard mode, every slave
+// takes it, whatever speed the bus runs at otherwise.
+#define I2C0_RECOVERY_HALF_BIT_us   5
+
+#define I2C0_RECOVERY_PINS          ((1 << I2C0_HW_SDA_BIT) | (1 << I2C0_HW_SCL_BIT))
+#define I2C0_RECOVERY_PULL(bit)     I2C0_HW_DDR |= (1 << (bit))
+#define I2C0_RECOVERY_RELEASE(bit)  I2C0_HW_DDR &= ~(1 << (bit))
+
+
+/// \brief
+/// Release SCL and wait as long as a slave stretches the clock. All
+/// waits of a recovery share one `I2C0_HW_EMERGENCY_TIMEOUT_us`, counted
+/// by Timer1 with `I2C0_HW_TIMEOUT_TIMER1`, else in `budget_us`.
+/// \returns 0 if SCL is high, ~0 if timed out.
+static uint8_t i2c0_recovery_rise_scl(uint32_t *budget_us)
+{
+    I2C0_RECOVERY_RELEASE(I2C0_HW_SCL_BIT);
+    while (I2C0_SCL_IS_LOW)
+    {
+#if defined I2C_HW_TWI_H_INCLUDED && defined I2C0_HW_TIMEOUT_TIMER1
+        (void)budget_us;
+        if (I2C0_TIMEOUT_EXPIRED)
+            return(~0);
+#else
+        if (!*budget_us)
+            return(~0);
+        (*budget_us)--;
+        _delay_us(1);
+#endif
+    }
+    return(0);
+}
+
+
+/// \brief
+/// Frees the bus from a slave keeping SDA low. Valid for the blocking
+/// master modes.
+/// \details
+/// A slave reset or disturbed within a byte keeps on driving its bit
+/// to SDA, waiting for the clock. The pins are taken as port pins, SCL
+/// is clocked up to 9 times until the slave releases SDA, then the
+/// 'STOP' is sent. The slave sees a 'NACK' at the end of its byte and
+/// is idle again. The TWI or USI gets re-initialized afterwards, the
+/// bit rate is kept. The recovery clocks run in standard mode, the
+/// bus is back within about 120 us. A slave stretching the clocks may
+/// add `I2C0_HW_EMERGENCY_TIMEOUT_us` in total, not per clock.
+///
+/// The single master modes call it when they find SDA low before the
+/// 'START', with `I2C0_HW_TIMEOUT_TIMER1` the waits of the TWI single
+/// master call it on a timeout as well, if SCL is high with the TWI off.
+/// Dedicated to TWI and USI equipped devices.
+/// \returns `I2C_SUCCESS` if the bus is free again, `I2C_SDA_BLOCKED`
+/// if the slave keeps SDA low, `I2C_TIMED_OUT` if SCL is kept low.
+/// Also left for `hardI2c0_check4Error()`.
+enum I2C_FAILURE_type i2c0_recover_bus(void)
+{
+    uint8_t port = I2C0_HW_PORT & I2C0_RECOVERY_PINS;
+    uint8_t ddr = I2C0_HW_DDR & I2C0_RECOVERY_PINS;
+    uint8_t clocks;
+    uint32_t budget_us = I2C0_HW_EMERGENCY_TIMEOUT_us;
+
+    i2c0_failure_info = I2C_SUCCESS;
+#if defined I2C_HW_TWI_H_INCLUDED && defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_ARM;
+#endif
+    // Open drain by the data direction, the port bits drive low.
+    I2C0_HW_DDR &= ~I2C0_RECOVERY_PINS;
+    I2C0_RECOVERY_BEGIN;
+    I2C0_HW_PORT &= ~I2C0_RECOVERY_PINS;
+    if (i2c0_recovery_rise_scl(&budget_us))
+        i2c0_failure_info = I2C_TIMED_OUT;
+    // Clock until the slave lets SDA go.
+    for (clocks = 9; clocks && I2C0_SDA_IS_LOW && !i2c0_failure_info; clocks--)
+    {
+        I2C0_RECOVERY_PULL(I2C0_HW_SCL_BIT);
+        _delay_us(I2C0_RECOVERY_HALF_BIT_us);
+        if (i2c0_recovery_rise_scl(&budget_us))
+            i2c0_failure_info = I2C_TIMED_OUT;
+        _delay_us(I2C0_RECOVERY_HALF_BIT_us);
+    }
+    if (!i2c0_failure_info)
+    {
+        // STOP: SDA rises while SCL is high.
+        I2C0_RECOVERY_PULL(I2C0_HW_SCL_BIT);
+        I2C0_RECOVERY_PULL(I2C0_HW_SDA_BIT);
+        _delay_us(I2C0_RECOVERY_HALF_BIT_us);
+        if (i2c0_recovery_rise_scl(&budget_us))
+            i2c0_failure_info = I2C_TIMED_OUT;
+        _delay_us(I2C0_RECOVERY_HALF_BIT_us);
+        I2C0_RECOVERY_RELEASE(I2C0_HW_SDA_BIT);
+        _delay_us(I2C0_RECOVERY_HALF_BIT_us);
+        if (I2C0_SDA_IS_LOW)
+            i2c0_failure_info |= I2C_SDA_BLOCKED;
+    }
+    // Pins as before, the peripheral takes them again.
+    I2C0_HW_DDR &= ~I2C0_RECOVERY_PINS;
+    I2C0_HW_PORT |= port;
+    I2C0_HW_DDR |= ddr;
+    I2C0_RECOVERY_END;
+    return(i2c0_failure_info);
+}
+
+
+#endif /* (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_BUS_RECOVERY) */
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c0_write_read.c
+// Description : Write to a slave, then read back by repeated START.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c0_write_read.c
+/// \brief  Combined write-then-read access in any master mode, TWI and
+/// USI alike.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+
+#if defined I2C_HW_TWI_H_INCLUDED && defined I2C0_HW_SINGLE_MASTER
+// Repeated START of the single master TWI right after the TWINT of the
+// last byte written. Unlike `twi0_open_device_single_master()` there is
+// no speed selection, no bus recovery and no failure reset, the bus is
+// owned and set up already.
+static enum I2C_FAILURE_type i2c0_restart_for_reading(uint8_t deviceAddress)
+{
+    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTA) | slaveAckControl;
+    if (twi0_wait_for_twint() || twi0_send_byte(deviceAddress))
+        return(i2c0_failure_info);
+    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    {
+        case 0x40:  /* address + R successfully sent */
+            break;
+        case 0x48:  /* address + R sent, but no ACK */
+            i2c0_failure_info |= I2C_NO_ACK;
+            break;
+        default:
+            i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+    }
+    return(i2c0_failure_info);
+}
+#endif
+
+/// \brief
+/// Write to a slave and read back from it within one bus access.
+/// \details
+/// Addresses the slave for writing and sends `writeCount` bytes. Then a
+/// repeated START turns the access around to read `readCount` bytes.
+/// Finally the bus is released - unless the arbitration got lost, then
+/// the bus belongs to the other master already.
+/// If `writeCount` is 0 the slave is addressed for reading right away.
+/// If `readCount` is 0 there is no read part.
+///
+/// The single master TWI asserts the repeated START itself, right after
+/// the last byte written. The other modes call `hardI2c0_openDevice()`
+/// for it, this function then is a convenience wrapper of the calls the
+/// application would make.
+/// With the USI the repeated START needs the full SCL low and high
+/// phases ahead of the falling SDA edge (t<SUB>SU;STA</SUB> of the bus
+/// specification), thus the half bit preparation of
+/// `hardI2c0_openDevice()` is kept.
+/// Dedicated to TWI and USI equipped devices.
+/// \param deviceAddress of the desired slave. The R/W-flag is ignored.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type i2c0_write_read(uint8_t deviceAddress,
+                                      const uint8_t *writeBuffer,
+                                      uint16_t writeCount,
+                                      uint8_t *readBuffer,
+                                      uint16_t readCount)
+{
+    enum I2C_FAILURE_type failure = I2C_SUCCESS;
+    if (writeCount || !readCount)
+        if (!(failure = hardI2c0_openDevice(deviceAddress & ~I2C_READ_ACCESS)))
+            failure = hardI2c0_writeBlock(writeBuffer, writeCount);
+    if (readCount && !failure)
+    {
+#if defined I2C_HW_TWI_H_INCLUDED && defined I2C0_HW_SINGLE_MASTER
+        // Repeated START follows the last byte written immediately.
+        if (writeCount)
+            failure = i2c0_restart_for_reading(deviceAddress | I2C_READ_ACCESS);
+        else
+#endif
+            failure = hardI2c0_openDevice(deviceAddress | I2C_READ_ACCESS);
+        if (!failure)
+            hardI2c0_readBlock(readBuffer, readCount);
+    }
+    if (!(i2c0_failure_info & I2C_ARBITRATION_LOST))
+        hardI2c0_releaseBus();
+    return(i2c0_failure_info);
+}
+
+
+#endif /* (defined(I2C_HW_TWI_H_INCLUDED) || defined(I2C_HW_USI_H_INCLUDED)) && defined(I2C0_HW_AS_MASTER) */
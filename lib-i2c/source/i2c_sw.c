@@ -27,7 +27,12 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// An instance of several gets its names from the instance header.
+#ifdef I2C_SW_INSTANCE
+#   include "i2c_sw_instance.h"
+#endif
 #include "i2c_sw.h"
+#include "i2c_timing.h"
 #include <avr/io.h>
 #include <util/delay.h>
 
@@ -49,12 +54,35 @@ enum I2C_FAILURE_type softI2c_failure_info = I2C_SUCCESS;
 
 #ifndef F_I2C_SW
 #   define F_I2C_SW 100000UL
-#   warning "'F_I2C_SW' found undefined. Now defaults to 100kHz.
+#   warning "'F_I2C_SW' found undefined. Now defaults to 100kHz."
 #endif
-void softI2c_waitHalfBitTime(void)
-{
-    _delay_us(500000UL/F_I2C_SW);
-}
+
+
+// CPU cycles of the SCL low and high phases, see i2c_timing.h.
+#define I2C_SW_LOW_PHASE_CYCLES     I2C_LOW_PHASE_CYCLES(F_I2C_SW)
+#define I2C_SW_HIGH_PHASE_CYCLES    I2C_HIGH_PHASE_CYCLES(F_I2C_SW)
+
+
+// CPU cycles the bit loops of softI2c_putByte() and softI2c_getByte()
+// spend in each SCL phase, counted from their instruction sequences with
+// SCL and SDA in the lower I/O space (sbi/cbi/sbis). Clock stretching is
+// not taken into account. If your compiler generates different code
+// override these in the Makefile.
+#ifndef I2C_SW_LOW_PHASE_OVERHEAD_CYCLES
+#   define I2C_SW_LOW_PHASE_OVERHEAD_CYCLES     10
+#endif
+#ifndef I2C_SW_HIGH_PHASE_OVERHEAD_CYCLES
+#   define I2C_SW_HIGH_PHASE_OVERHEAD_CYCLES    5
+#endif
+
+#if I2C_SW_LOW_PHASE_CYCLES < I2C_SW_LOW_PHASE_OVERHEAD_CYCLES || \
+    I2C_SW_HIGH_PHASE_CYCLES < I2C_SW_HIGH_PHASE_OVERHEAD_CYCLES
+#   warning "'F_I2C_SW' is out of reach at this 'F_CPU', the bus runs slower."
+#endif
+
+
+#define I2C_SW_LOW_PHASE_DELAY      I2C_DELAY_REMAINING_CYCLES(I2C_SW_LOW_PHASE_CYCLES, I2C_SW_LOW_PHASE_OVERHEAD_CYCLES)
+#define I2C_SW_HIGH_PHASE_DELAY     I2C_DELAY_REMAINING_CYCLES(I2C_SW_HIGH_PHASE_CYCLES, I2C_SW_HIGH_PHASE_OVERHEAD_CYCLES)
 
 
 // I2C bus definition:
@@ -63,23 +91,46 @@ void softI2c_waitHalfBitTime(void)
 // rupted.
 #ifndef I2C_SW_EMERGENCY_TIMEOUT_us
 #   define I2C_SW_EMERGENCY_TIMEOUT_us 20000UL
-#   warning "'I2C_SW_EMERGENCY_TIMEOUT_us' found undefined. Now defaults to 20ms.
+#   warning "'I2C_SW_EMERGENCY_TIMEOUT_us' found undefined. Now defaults to 20ms."
 #endif
+
+
+// The SCL readback is polled every I2C_SW_STRETCH_POLL_CYCLES, see
+// i2c_timing.h.
+#define I2C_SW_STRETCH_POLL_CYCLES  I2C_STRETCH_POLL_CYCLES(I2C_SW_EMERGENCY_TIMEOUT_us)
+#define I2C_SW_STRETCH_POLLS        I2C_STRETCH_POLLS(I2C_SW_EMERGENCY_TIMEOUT_us)
+
+
+// Release SCL and wait as long as a slave stretches the clock. Costs a
+// single readback if nobody does.
+#define I2C_SW_RISE_SCL                                                     \
+    do                                                                      \
+    {                                                                       \
+        uint16_t polls = I2C_SW_STRETCH_POLLS;                              \
+        I2C_SW_RELEASE_SCL;                                                 \
+        while (!I2C_SW_SCL_IS_HIGH)                                         \
+        {                                                                   \
+            if (!--polls)                                                   \
+            {                                                               \
+                softI2c_failure_info |= I2C_TIMED_OUT;                      \
+                break;                                                      \
+            }                                                               \
+            __builtin_avr_delay_cycles(I2C_SW_STRETCH_POLL_CYCLES - 6);     \
+        }                                                                   \
+    } while (0)
+
+
+void softI2c_waitHalfBitTime(void)
+{
+    __builtin_avr_delay_cycles(I2C_SW_LOW_PHASE_CYCLES);
+}
+
+
 void softI2c_releaseScl(void)
 {
-    uint16_t    count_us;
-    softI2c_waitHalfBitTime();
-    I2C_SW_RELEASE_SCL;
-    for (count_us=0; !I2C_SW_SCL_IS_HIGH; count_us++)
-    {
-        if (count_us >= I2C_SW_EMERGENCY_TIMEOUT_us)
-        {
-            softI2c_failure_info |= I2C_TIMED_OUT;
-            break;
-        }
-        _delay_us(1);
-    }
     softI2c_waitHalfBitTime();
+    I2C_SW_RISE_SCL;
+    __builtin_avr_delay_cycles(I2C_SW_HIGH_PHASE_CYCLES);
 }
 
 
@@ -108,6 +159,10 @@ void softI2c_init(void)
     I2C_SW_SDA_PORT &= ~I2C_SW_SDA_BITPOS;
     I2C_SW_SCL_PORT &= ~I2C_SW_SCL_BITPOS;
     softI2c_releaseBus();
+#ifdef I2C_SW_BUS_RECOVERY
+    if (!I2C_SW_SDA_IS_HIGH)
+        softI2c_recoverBus();
+#endif
 }
 
 
@@ -115,18 +170,22 @@ void softI2c_init(void)
 void softI2c_putByte(uint8_t dataByte)
 {
     uint8_t counter;
-    for (counter=0; counter<8; counter++)
+    for (counter=8; counter; counter--)
     {
         if (dataByte & 0x80)
             I2C_SW_RELEASE_SDA;
         else
             I2C_SW_PULL_SDA;
         dataByte <<= 1;
-        softI2c_releaseScl();
+        I2C_SW_LOW_PHASE_DELAY;
+        I2C_SW_RISE_SCL;
+        I2C_SW_HIGH_PHASE_DELAY;
         I2C_SW_PULL_SCL;
     }
     I2C_SW_RELEASE_SDA;
-    softI2c_releaseScl();
+    I2C_SW_LOW_PHASE_DELAY;
+    I2C_SW_RISE_SCL;
+    I2C_SW_HIGH_PHASE_DELAY;
     if (I2C_SW_SDA_IS_HIGH)
         softI2c_failure_info |= I2C_NO_ACK;
     I2C_SW_PULL_SCL;
@@ -139,9 +198,11 @@ uint8_t softI2c_getByte(uint8_t sendAck)
     uint8_t counter;
     uint8_t dataByte=0;
     I2C_SW_RELEASE_SDA;
-    for (counter=0; counter<8; counter++)
+    for (counter=8; counter; counter--)
     {
-        softI2c_releaseScl();
+        I2C_SW_LOW_PHASE_DELAY;
+        I2C_SW_RISE_SCL;
+        I2C_SW_HIGH_PHASE_DELAY;
         dataByte <<= 1;
         if (I2C_SW_SDA_IS_HIGH)
             dataByte |= 0x01;
@@ -151,7 +212,9 @@ uint8_t softI2c_getByte(uint8_t sendAck)
         I2C_SW_PULL_SDA;
     else
         I2C_SW_RELEASE_SDA;
-    softI2c_releaseScl();
+    I2C_SW_LOW_PHASE_DELAY;
+    I2C_SW_RISE_SCL;
+    I2C_SW_HIGH_PHASE_DELAY;
     I2C_SW_PULL_SCL;
     return(dataByte);
 }
@@ -163,6 +226,10 @@ enum I2C_FAILURE_type softI2c_openDevice(uint8_t address)
 {
     softI2c_failure_info = I2C_SUCCESS;
     softI2c_releaseSda();
+#ifdef I2C_SW_BUS_RECOVERY
+    if (softI2c_failure_info && softI2c_recoverBus())
+        return(softI2c_failure_info);
+#endif
     softI2c_releaseScl();
     I2C_SW_PULL_SDA;
     softI2c_waitHalfBitTime();
@@ -181,6 +248,76 @@ void softI2c_releaseBus(void)
 }
 
 
+// Put a block of bytes to the bus, stop at first failure.
+enum I2C_FAILURE_type softI2c_writeBlock(const uint8_t *buffer, uint16_t length)
+{
+    while (length--)
+    {
+        softI2c_putByte(*buffer++);
+        if (softI2c_failure_info)
+            break;
+    }
+    return(softI2c_failure_info);
+}
+
+
+// Read a block of bytes from the bus, NACK the last one.
+enum I2C_FAILURE_type softI2c_readBlock(uint8_t *buffer, uint16_t length)
+{
+    while (length)
+    {
+        length--;
+        *buffer++ = softI2c_getByte(length != 0);
+        if (softI2c_failure_info)
+            break;
+    }
+    return(softI2c_failure_info);
+}
+
+
+// Address a device, read/write 'messageSize' byte from/to
+// 'buffer_p' and release the bus.
+enum I2C_FAILURE_type softI2c_accessDevice(uint8_t address, uint8_t *buffer_p, uint16_t messageSize)
+{
+    if (!softI2c_openDevice(address))
+    {
+        if (address & I2C_READ_ACCESS)
+            softI2c_readBlock(buffer_p, messageSize);
+        else
+            softI2c_writeBlock(buffer_p, messageSize);
+    }
+    softI2c_releaseBus();
+    return(softI2c_failure_info);
+}
+
+
+#ifdef I2C_SW_BUS_RECOVERY
+// Clock a slave out which keeps SDA low, up to 9 clocks, then STOP.
+enum I2C_FAILURE_type softI2c_recoverBus(void)
+{
+    uint8_t counter;
+    softI2c_failure_info = I2C_SUCCESS;
+    I2C_SW_RELEASE_SDA;
+    I2C_SW_RISE_SCL;
+    for (counter=9; counter && !I2C_SW_SDA_IS_HIGH && !softI2c_failure_info; counter--)
+    {
+        I2C_SW_PULL_SCL;
+        I2C_SW_LOW_PHASE_DELAY;
+        I2C_SW_RISE_SCL;
+        I2C_SW_HIGH_PHASE_DELAY;
+    }
+    if (!softI2c_failure_info)
+    {
+        I2C_SW_PULL_SCL;
+        I2C_SW_PULL_SDA;
+        softI2c_releaseScl();
+        softI2c_releaseSda();
+    }
+    return(softI2c_failure_info);
+}
+#endif
+
+
 // Retrieve errors occuring during last access.
 enum I2C_FAILURE_type softI2c_check4Error(void)
 {
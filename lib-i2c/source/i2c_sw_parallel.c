@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_sw_parallel.c
+// Description : Software emulated master driving up to 8 buses at once.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   i2c_sw_parallel.c
+/// \brief
+/// Parallel software master, see `i2c_sw_parallel.h`.
+/// \details
+/// The bytes are turned into bit planes before a byte is clocked, one
+/// plane per bit holding this bit of all buses. The bit loops then
+/// just write a plane to the SDA data direction register or read the
+/// readback into a plane. Received planes are turned back into bytes
+/// after the byte.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_sw_parallel.h"
+#include "i2c_timing.h"
+#include <avr/io.h>
+
+
+#define I2C_PAR_RELEASE_SCL     I2C_PAR_SCL_DDR &= ~I2C_PAR_SCL_BITPOS
+#define I2C_PAR_PULL_SCL        I2C_PAR_SCL_DDR |= I2C_PAR_SCL_BITPOS
+#define I2C_PAR_RELEASE_SDA     I2C_PAR_SDA_DDR &= ~I2C_PAR_SDA_MASK
+#define I2C_PAR_PULL_SDA        I2C_PAR_SDA_DDR |= I2C_PAR_SDA_MASK
+#define I2C_PAR_SCL_IS_HIGH     (I2C_PAR_SCL_READBACK & (I2C_PAR_SCL_BITPOS))
+
+// One write of a bit plane, `pulled` has a bit set for each SDA to pull.
+#define I2C_PAR_DRIVE_SDA(pulled) \
+    I2C_PAR_SDA_DDR = (I2C_PAR_SDA_DDR & ~I2C_PAR_SDA_MASK) | (pulled)
+
+
+// CPU cycles of the SCL phases, see i2c_timing.h.
+#define I2C_PAR_LOW_PHASE_CYCLES    I2C_LOW_PHASE_CYCLES(F_I2C_PAR)
+#define I2C_PAR_HIGH_PHASE_CYCLES   I2C_HIGH_PHASE_CYCLES(F_I2C_PAR)
+
+
+// CPU cycles the bit loops spend in each SCL phase. The low phase holds
+// the read-modify-write of the SDA data direction register and the plane
+// access, the high phase the SCL readback and the plane store.
+#ifndef I2C_PAR_LOW_PHASE_OVERHEAD_CYCLES
+#   define I2C_PAR_LOW_PHASE_OVERHEAD_CYCLES    14
+#endif
+#ifndef I2C_PAR_HIGH_PHASE_OVERHEAD_CYCLES
+#   define I2C_PAR_HIGH_PHASE_OVERHEAD_CYCLES   7
+#endif
+
+#if I2C_PAR_LOW_PHASE_CYCLES < I2C_PAR_LOW_PHASE_OVERHEAD_CYCLES || \
+    I2C_PAR_HIGH_PHASE_CYCLES < I2C_PAR_HIGH_PHASE_OVERHEAD_CYCLES
+#   warning "'F_I2C_PAR' is out of reach at this 'F_CPU', the buses run slower."
+#endif
+
+#define I2C_PAR_LOW_PHASE_DELAY     I2C_DELAY_REMAINING_CYCLES(I2C_PAR_LOW_PHASE_CYCLES, I2C_PAR_LOW_PHASE_OVERHEAD_CYCLES)
+#define I2C_PAR_HIGH_PHASE_DELAY    I2C_DELAY_REMAINING_CYCLES(I2C_PAR_HIGH_PHASE_CYCLES, I2C_PAR_HIGH_PHASE_OVERHEAD_CYCLES)
+
+
+// SCL stretch polling, see i2c_timing.h.
+#define I2C_PAR_STRETCH_POLL_CYCLES I2C_STRETCH_POLL_CYCLES(I2C_PAR_EMERGENCY_TIMEOUT_us)
+#define I2C_PAR_STRETCH_POLLS       I2C_STRETCH_POLLS(I2C_PAR_EMERGENCY_TIMEOUT_us)
+
+#define I2C_PAR_RISE_SCL                                                    \
+    do                                                                      \
+    {                                                                       \
+        uint16_t polls = I2C_PAR_STRETCH_POLLS;                             \
+        I2C_PAR_RELEASE_SCL;                                                \
+        while (!I2C_PAR_SCL_IS_HIGH)                                        \
+        {                                                                   \
+            if (!--polls)                                                   \
+            {                                                               \
+                parI2c_failure_info |= I2C_TIMED_OUT;                       \
+                break;                                                      \
+            }                                                               \
+            __builtin_avr_delay_cycles(I2C_PAR_STRETCH_POLL_CYCLES - 6);    \
+        }                                                                   \
+    } while (0)
+
+
+// =============================================================================
+// These are for internal usage.
+// =============================================================================
+
+static enum I2C_FAILURE_type parI2c_failure_info = I2C_SUCCESS;
+
+
+// Clock out 8 bit planes MSB first, return the ACK bitmap.
+static uint8_t parI2c_shiftOut(const uint8_t *pulled)
+{
+    uint8_t bit;
+    uint8_t acknowledged;
+
+    for (bit = 8; bit; )
+    {
+        bit--;
+        I2C_PAR_DRIVE_SDA(pulled[bit]);
+        I2C_PAR_LOW_PHASE_DELAY;
+        I2C_PAR_RISE_SCL;
+        I2C_PAR_HIGH_PHASE_DELAY;
+        I2C_PAR_PULL_SCL;
+    }
+    I2C_PAR_RELEASE_SDA;
+    I2C_PAR_LOW_PHASE_DELAY;
+    I2C_PAR_RISE_SCL;
+    acknowledged = ~I2C_PAR_SDA_READBACK & I2C_PAR_SDA_MASK;
+    I2C_PAR_HIGH_PHASE_DELAY;
+    I2C_PAR_PULL_SCL;
+    return(acknowledged);
+}
+
+
+// Give a START to all buses.
+static void parI2c_start(void)
+{
+    I2C_PAR_RELEASE_SDA;
+    __builtin_avr_delay_cycles(I2C_PAR_LOW_PHASE_CYCLES);
+    I2C_PAR_RISE_SCL;
+    __builtin_avr_delay_cycles(I2C_PAR_HIGH_PHASE_CYCLES);
+    I2C_PAR_PULL_SDA;
+    __builtin_avr_delay_cycles(I2C_PAR_LOW_PHASE_CYCLES);
+    I2C_PAR_PULL_SCL;
+}
+
+
+// =============================================================================
+// These are the PUBLIC ones.
+// =============================================================================
+
+// Initialize the IO-lines and the buses.
+void parI2c_init(void)
+{
+    I2C_PAR_SDA_PORT &= ~I2C_PAR_SDA_MASK;
+    I2C_PAR_SCL_PORT &= ~I2C_PAR_SCL_BITPOS;
+    parI2c_releaseBus();
+}
+
+
+// Address the slaves on all buses, return the ACK bitmap.
+uint8_t parI2c_openDevice(uint8_t address)
+{
+    parI2c_failure_info = I2C_SUCCESS;
+    parI2c_start();
+    return(parI2c_putByte(address));
+}
+
+
+// Put the same byte to all buses, return the ACK bitmap.
+uint8_t parI2c_putByte(uint8_t dataByte)
+{
+    uint8_t pulled[8];
+    uint8_t bit;
+
+    for (bit = 0; bit < 8; bit++)
+    {
+        pulled[bit] = (dataByte & 0x01) ? 0 : I2C_PAR_SDA_MASK;
+        dataByte >>= 1;
+    }
+    return(parI2c_shiftOut(pulled));
+}
+
+
+// Put dataBytes[n] to bus n, return the ACK bitmap.
+uint8_t parI2c_putBytes(const uint8_t *dataBytes)
+{
+    uint8_t pulled[8] = {0};
+    uint8_t bus, busMask, bit, dataByte;
+
+    for (bus = 0, busMask = 1; busMask; bus++, busMask <<= 1)
+    {
+        if (!(I2C_PAR_SDA_MASK & busMask))
+            continue;
+        dataByte = dataBytes[bus];
+        for (bit = 0; bit < 8; bit++)
+        {
+            if (!(dataByte & 0x01))
+                pulled[bit] |= busMask;
+            dataByte >>= 1;
+        }
+    }
+    return(parI2c_shiftOut(pulled));
+}
+
+
+// Read dataBytes[n] from bus n, 'sendAck' gives acknowledge to all.
+void parI2c_getBytes(uint8_t *dataBytes, uint8_t sendAck)
+{
+    uint8_t sampled[8];
+    uint8_t bus, busMask, bit, dataByte;
+
+    I2C_PAR_RELEASE_SDA;
+    for (bit = 8; bit; )
+    {
+        bit--;
+        I2C_PAR_LOW_PHASE_DELAY;
+        I2C_PAR_RISE_SCL;
+        I2C_PAR_HIGH_PHASE_DELAY;
+        sampled[bit] = I2C_PAR_SDA_READBACK;
+        I2C_PAR_PULL_SCL;
+    }
+    if (sendAck)
+        I2C_PAR_PULL_SDA;
+    I2C_PAR_LOW_PHASE_DELAY;
+    I2C_PAR_RISE_SCL;
+    I2C_PAR_HIGH_PHASE_DELAY;
+    I2C_PAR_PULL_SCL;
+    I2C_PAR_RELEASE_SDA;
+
+    for (bus = 0, busMask = 1; busMask; bus++, busMask <<= 1)
+    {
+        if (!(I2C_PAR_SDA_MASK & busMask))
+            continue;
+        dataByte = 0;
+        for (bit = 8; bit; )
+        {
+            bit--;
+            dataByte <<= 1;
+            if (sampled[bit] & busMask)
+                dataByte |= 0x01;
+        }
+        dataBytes[bus] = dataByte;
+    }
+}
+
+
+// Release all buses by sending the STOP-sequence.
+void parI2c_releaseBus(void)
+{
+    I2C_PAR_PULL_SDA;
+    __builtin_avr_delay_cycles(I2C_PAR_LOW_PHASE_CYCLES);
+    I2C_PAR_RISE_SCL;
+    __builtin_avr_delay_cycles(I2C_PAR_HIGH_PHASE_CYCLES);
+    I2C_PAR_RELEASE_SDA;
+    if ((I2C_PAR_SDA_READBACK & I2C_PAR_SDA_MASK) != I2C_PAR_SDA_MASK)
+        parI2c_failure_info |= I2C_SDA_BLOCKED;
+}
+
+
+// Retrieve errors occuring during last access.
+enum I2C_FAILURE_type parI2c_check4Error(void)
+{
+    return(parI2c_failure_info);
+}
@@ -16,14 +16,34 @@
 
 
 #include "i2c_hw.h"
-#if defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_AS_MASTER) && !defined (I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// Events of the address check, see TWI0_STATUS_INDEX().
+enum TWI0_ADDRESSED_EVENT_type
+{
+    TWI0_ADDRESSED_OTHER = 0,
+    TWI0_ADDRESSED_IDLE,
+    TWI0_ADDRESSED_ADDRESSED,
+    TWI0_ADDRESSED_BUS_ERROR
+};
+
+static const uint8_t twi0_addressed_event[32] PROGMEM =
+{
+    [TWI0_STATUS_INDEX(0xF8)] = TWI0_ADDRESSED_IDLE,        /* TWI idle or in transfer */
+    [TWI0_STATUS_INDEX(0x60)] = TWI0_ADDRESSED_ADDRESSED,   /* own address + W received */
+    [TWI0_STATUS_INDEX(0x70)] = TWI0_ADDRESSED_ADDRESSED,   /* general call address received */
+    [TWI0_STATUS_INDEX(0xA8)] = TWI0_ADDRESSED_ADDRESSED,   /* own address + R received */
+    [TWI0_STATUS_INDEX(0x00)] = TWI0_ADDRESSED_BUS_ERROR    /* Bus error (illegal START or STOP) */
+};
 
 /// \brief
 /// Check if addressed as a slave device when just being a slave.
 /// \details
 /// Dedicated to TWI equipped devices.
+/// The status codes are dispatched by a table in flash.
 /// \param addressReceived contains the assigned (base) address of
 /// slave response(s). Used to report the complete address received
 /// in case the slave responds to an address range.
@@ -31,17 +51,15 @@
 uint8_t twi0_addressed_as_slave (uint8_t* addressReceived)
 {
     i2c0_failure_info = I2C_SUCCESS;
-    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    switch (TWI0_STATUS_EVENT(twi0_addressed_event))
     {
-        case 0xF8:  /* TWI idle or in transfer */
+        case TWI0_ADDRESSED_IDLE:
             return(0);
-        case 0x60:  /* own address + W received */
-        case 0x70:  /* general call address received */
-        case 0xA8:  /* own address + R received */
+        case TWI0_ADDRESSED_ADDRESSED:
             *addressReceived = I2C0_HW_DATA_REG;
             return(~0);
             break;
-        case 0x00:
+        case TWI0_ADDRESSED_BUS_ERROR:
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
         default:
             i2c0_failure_info |= I2C_PROTOCOL_FAIL;
@@ -50,4 +68,4 @@ uint8_t twi0_addressed_as_slave (uint8_t* addressReceived)
 }
 
 
-#endif /* defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_AS_MASTER) */
+#endif /* defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_AS_MASTER) && !defined (I2C0_HW_INTERRUPT_DRIVEN) */
@@ -19,43 +19,67 @@
 #if defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && (I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// Events of the address check, see TWI0_STATUS_INDEX().
+enum TWI0_ADDRESSED_MM_EVENT_type
+{
+    TWI0_ADDRESSED_MM_OTHER = 0,
+    TWI0_ADDRESSED_MM_STOPPED,
+    TWI0_ADDRESSED_MM_IDLE,
+    TWI0_ADDRESSED_MM_BUS_OCCUPIED,
+    TWI0_ADDRESSED_MM_ARBITRATION_LOST,
+    TWI0_ADDRESSED_MM_ADDRESSED,
+    TWI0_ADDRESSED_MM_BUS_ERROR
+};
+
+static const uint8_t twi0_addressed_mm_event[32] PROGMEM =
+{
+    [TWI0_STATUS_INDEX(0xA0)] = TWI0_ADDRESSED_MM_STOPPED,          /* STOP or repeated START condition from remote master */
+    [TWI0_STATUS_INDEX(0xC0)] = TWI0_ADDRESSED_MM_STOPPED,          /* byte sent, no ACK received */
+    [TWI0_STATUS_INDEX(0xC8)] = TWI0_ADDRESSED_MM_STOPPED,          /* last byte sent, but ACK received */
+    [TWI0_STATUS_INDEX(0xF8)] = TWI0_ADDRESSED_MM_IDLE,             // TWI idle or in transfer
+    [TWI0_STATUS_INDEX(0x38)] = TWI0_ADDRESSED_MM_BUS_OCCUPIED,     // arbitration lost, not addressed by remote master
+    [TWI0_STATUS_INDEX(0x68)] = TWI0_ADDRESSED_MM_ARBITRATION_LOST, // arbitration lost, own address + W received while acting as master
+    [TWI0_STATUS_INDEX(0x78)] = TWI0_ADDRESSED_MM_ARBITRATION_LOST, // arbitration lost, general call address received while acting as master
+    [TWI0_STATUS_INDEX(0xB0)] = TWI0_ADDRESSED_MM_ARBITRATION_LOST, // arbitration lost, own address + R received while acting as master
+    [TWI0_STATUS_INDEX(0x60)] = TWI0_ADDRESSED_MM_ADDRESSED,        // own address + W received
+    [TWI0_STATUS_INDEX(0x70)] = TWI0_ADDRESSED_MM_ADDRESSED,        // general call address received
+    [TWI0_STATUS_INDEX(0xA8)] = TWI0_ADDRESSED_MM_ADDRESSED,        // own address + R received
+    [TWI0_STATUS_INDEX(0x00)] = TWI0_ADDRESSED_MM_BUS_ERROR         // Bus error (illegal START or STOP)
+};
 
 /// \brief
 /// Check if addressed as a slave device when in multimaster mode.
 /// \details
 /// Dedicated to TWI equipped devices.
 /// Keeps track with possible arbitration loss.
+/// The status codes are dispatched by a table in flash.
 /// \param is used to report the complete address received
 /// in case the slave responds to an address range.
 /// \returns selection state, ~0 if selected, 0 if not.
 uint8_t twi0_addressed_as_slave_multi_master (uint8_t *addressReceived)
 {
-    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    switch (TWI0_STATUS_EVENT(twi0_addressed_mm_event))
     {
-        case 0xA0:  /* STOP or repeated START condition from remote master */
-        case 0xC0:  /* byte sent, no ACK received */
-        case 0xC8:  /* last byte sent, but ACK received */
+        case TWI0_ADDRESSED_MM_STOPPED:
             i2c0_failure_info = I2C_STOPPED;
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | slaveAckControl;
-        case 0xF8:  // 11111 TWI idle or in transfer
+        case TWI0_ADDRESSED_MM_IDLE:
             return(0);
-        case 0x38:  // 00111 arbitration lost, not addressed by remote master
+        case TWI0_ADDRESSED_MM_BUS_OCCUPIED:
             i2c0_failure_info = I2C_RESTARTED; // here means "bus is occupied"
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | slaveAckControl;
             return(0);
-        case 0x68:  // 01101 arbitration lost, own address + W received while acting as master
-        case 0x78:  // 01111 arbitration lost, general call address received while acting as master
-        case 0xB0:  // 10110 arbitration lost, own address + R received while acting as master
+        case TWI0_ADDRESSED_MM_ARBITRATION_LOST:
             i2c0_failure_info = I2C_ARBITRATION_LOST;
             *addressReceived = I2C0_HW_DATA_REG;
             return(~0);
-        case 0x60:  // 01100 own address + W received
-        case 0x70:  // 01110 general call address received
-        case 0xA8:  // 10101 own address + R received
+        case TWI0_ADDRESSED_MM_ADDRESSED:
             i2c0_failure_info = I2C_SUCCESS;
             *addressReceived = I2C0_HW_DATA_REG;
             return(~0);
-        case 0x00:
+        case TWI0_ADDRESSED_MM_BUS_ERROR:
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
         default:
             i2c0_failure_info = I2C_PROTOCOL_FAIL;
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -27,11 +27,8 @@
 /// Makes the TWI to send a STOP condition to the bus.
 void twi0_assert_stop_sequence(void)
 {
-    // Assert stop condition.
-    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
-    // Wait until done. Necessary?
-//  while (I2C0_HW_CONTROL_REG & (1 << TWSTO)) {}
+    twi0_assert_stop_sequence_inline();
 }
 
 
-#endif /* defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) */
+#endif /* defined (I2C_HW_TWI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined (I2C_HW_TWI_H_INCLUDED) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined (I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 
 /// \brief
@@ -27,8 +27,8 @@
 /// See `i2c_def.h`
 enum I2C_FAILURE_type twi0_check4Error(void)
 {
-    return(i2c0_failure_info);
+    return(twi0_check4Error_inline());
 }
 
 
-#endif /* defined (I2C_HW_TWI_H_INCLUDED) */
+#endif /* defined (I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
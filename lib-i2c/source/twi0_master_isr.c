@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_master_isr.c
+// Description : TWI interrupt, drives a master transaction.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_master_isr.c
+/// \brief  Interrupt service routine of the interrupt driven TWI master.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+// Events of the master, see TWI0_STATUS_INDEX().
+enum TWI0_MASTER_ISR_EVENT_type
+{
+    TWI0_MASTER_ISR_OTHER = 0,
+    TWI0_MASTER_ISR_STARTED,
+    TWI0_MASTER_ISR_SENT,
+    TWI0_MASTER_ISR_ADDRESSED_R,
+    TWI0_MASTER_ISR_RECEIVED,
+    TWI0_MASTER_ISR_RECEIVED_LAST,
+    TWI0_MASTER_ISR_NO_ACK,
+    TWI0_MASTER_ISR_ARBITRATION_LOST
+};
+
+static const uint8_t twi0_master_isr_event[32] PROGMEM =
+{
+    [TWI0_STATUS_INDEX(0x08)] = TWI0_MASTER_ISR_STARTED,           /* START sent */
+    [TWI0_STATUS_INDEX(0x10)] = TWI0_MASTER_ISR_STARTED,           /* repeated START sent */
+    [TWI0_STATUS_INDEX(0x18)] = TWI0_MASTER_ISR_SENT,              /* address + W successfully sent */
+    [TWI0_STATUS_INDEX(0x28)] = TWI0_MASTER_ISR_SENT,              /* data byte successfully sent */
+    [TWI0_STATUS_INDEX(0x40)] = TWI0_MASTER_ISR_ADDRESSED_R,       /* address + R successfully sent */
+    [TWI0_STATUS_INDEX(0x50)] = TWI0_MASTER_ISR_RECEIVED,          /* data byte received, ACK returned */
+    [TWI0_STATUS_INDEX(0x58)] = TWI0_MASTER_ISR_RECEIVED_LAST,     /* last data byte received, NACK returned */
+    [TWI0_STATUS_INDEX(0x20)] = TWI0_MASTER_ISR_NO_ACK,            /* address + W sent, but no ACK */
+    [TWI0_STATUS_INDEX(0x30)] = TWI0_MASTER_ISR_NO_ACK,            /* data byte sent, but no ACK */
+    [TWI0_STATUS_INDEX(0x48)] = TWI0_MASTER_ISR_NO_ACK,            /* address + R sent, but no ACK */
+    [TWI0_STATUS_INDEX(0x38)] = TWI0_MASTER_ISR_ARBITRATION_LOST   /* arbitration lost */
+};
+
+/// \brief
+/// TWI interrupt. Processes the transaction submitted by
+/// `twi0_start_transaction()`.
+/// \details
+/// Each bus event of the transaction is handled according to the TWI
+/// status code. When the transaction is done - successfully or not - the
+/// interrupt disables itself, this is what `twi0_transaction_pending()`
+/// checks for. The failure code(s) go to the status record of the
+/// transaction, copied to `i2c0_failure_info` when it is done.
+/// With `I2C0_HW_QUEUE_SIZE` set the next transaction queued follows
+/// right away: the STOP and the next START are asserted at once. With
+/// `I2C0_HW_CHAIN_TRANSACTIONS` a repeated START links them instead, the
+/// STOP follows the last transaction of the queue only.
+/// The status codes are dispatched by a table in flash.
+/// Dedicated to TWI equipped devices.
+ISR(TWI_vect)
+{
+    // Transaction done: assert stop condition and disable interrupt.
+    uint8_t control = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO);
+
+    switch (TWI0_STATUS_EVENT(twi0_master_isr_event))
+    {
+        case TWI0_MASTER_ISR_STARTED:
+            I2C0_HW_DATA_REG = i2c0_transaction.deviceAddress;
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT);
+            return;
+        case TWI0_MASTER_ISR_SENT:
+            if (i2c0_transaction.writeCount)
+            {
+                i2c0_transaction.writeCount--;
+                I2C0_HW_DATA_REG = *i2c0_transaction.writeBuffer++;
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT);
+                return;
+            }
+            if (i2c0_transaction.readCount)
+            {
+                // Turn around by a repeated START.
+                i2c0_transaction.deviceAddress |= I2C_READ_ACCESS;
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWSTA);
+                return;
+            }
+            break;
+        case TWI0_MASTER_ISR_ADDRESSED_R:
+            // ACK unless the first byte is the last byte already.
+            if (i2c0_transaction.readCount > 1)
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWEA);
+            else
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT);
+            return;
+        case TWI0_MASTER_ISR_RECEIVED:
+            *i2c0_transaction.readBuffer++ = I2C0_HW_DATA_REG;
+            if (--i2c0_transaction.readCount > 1)
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWEA);
+            else
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT);
+            return;
+        case TWI0_MASTER_ISR_RECEIVED_LAST:
+            *i2c0_transaction.readBuffer = I2C0_HW_DATA_REG;
+            i2c0_transaction.readCount = 0;
+            break;
+        case TWI0_MASTER_ISR_NO_ACK:
+            i2c0_transaction.status->failure |= I2C_NO_ACK;
+            break;
+        case TWI0_MASTER_ISR_ARBITRATION_LOST:
+            // Bus is owned by the other master, no STOP.
+            i2c0_transaction.status->failure |= I2C_ARBITRATION_LOST;
+            control = (1 << TWEN) | (1 << TWINT);
+            break;
+        default:
+            i2c0_transaction.status->failure |= I2C_PROTOCOL_FAIL;
+    }
+    i2c0_failure_info = i2c0_transaction.status->failure;
+    i2c0_transaction.status->pending = 0;
+#if defined I2C0_HW_QUEUE_SIZE
+    uint8_t tail = (i2c0_queue_tail + 1) & (I2C0_HW_QUEUE_SIZE - 1);
+    i2c0_queue_tail = tail;
+    if (tail != i2c0_queue_head)
+    {
+        i2c0_transaction = i2c0_queue[tail];
+#   if defined I2C0_HW_CHAIN_TRANSACTIONS
+        // Bus still owned: keep it by a repeated START.
+        control &= ~(1 << TWSTO);
+#   endif
+        control |= (1 << TWIE) | (1 << TWSTA);
+    }
+#endif
+    I2C0_HW_CONTROL_REG = control;
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -35,6 +35,9 @@
 enum I2C_FAILURE_type twi0_open_device_multi_master(uint8_t deviceAddress)
 {
 //uint8_t twistat = I2C0_HW_STATUS_REG & (0b11111<<TWS3);
+#if defined I2C0_HW_SPEED_SLAVES
+    twi0_select_speed(deviceAddress);
+#endif
     switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
     {
         case 0x08:  // 00001 START already successfully sent
@@ -43,8 +46,9 @@ enum I2C_FAILURE_type twi0_open_device_multi_master(uint8_t deviceAddress)
         default:
             // Assert start condition - TWI-HW will wait for the next opportunity
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTA) | slaveAckControl;
-            // Wait until done.
-            while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+            // Wait until done, as long as another master holds the bus.
+            if (twi0_wait_for_start())
+                return(i2c0_failure_info);
     }
     // Datasheet requires to clear TWSTA after START has been sent!
     I2C0_HW_CONTROL_REG &= ~((1 << TWINT) | (1 << TWSTA));
@@ -53,7 +57,8 @@ enum I2C_FAILURE_type twi0_open_device_multi_master(uint8_t deviceAddress)
         case 0x08:  // 00001 START successfully sent
         case 0x10:  // 00010 repeated START successfully sent
             // Try to send out the addressfield
-            twi0_send_byte(deviceAddress);
+            if (twi0_send_byte(deviceAddress))
+                return(i2c0_failure_info);
             switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
             {
                 case 0x18:  // 00011 address + W successfully sent
@@ -25,6 +25,8 @@
 /// \details
 /// Asserts a start sequence to the bus, followed by the slave
 /// address.
+/// With `I2C0_HW_BUS_RECOVERY` a slave keeping SDA low gets clocked
+/// out first, see `i2c0_recover_bus()`.
 /// Dedicated to TWI equipped devices.
 /// \param deviceAddress defines which slave to access. It shall
 /// define the READ or WRITE mode also.
@@ -32,13 +34,21 @@
 /// See `i2c_def.h`
 enum I2C_FAILURE_type twi0_open_device_single_master(uint8_t deviceAddress)
 {
+#if defined I2C0_HW_SPEED_SLAVES
+    twi0_select_speed(deviceAddress);
+#endif
+#if defined I2C0_HW_BUS_RECOVERY
+    // Nobody else drives SDA low on an idle bus.
+    if (I2C0_SDA_IS_BLOCKED && i2c0_recover_bus())
+        return(i2c0_failure_info);
+#endif
     // Clear previous failures.
     i2c0_failure_info = I2C_SUCCESS;
     // Assert start condition.
     I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTA) | slaveAckControl;
     // Wait until done.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
-    twi0_send_byte(deviceAddress);
+    if (twi0_wait_for_twint() || twi0_send_byte(deviceAddress))
+        return(i2c0_failure_info);
     switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
     {
         case 0x18:  /* address + W successfully sent */
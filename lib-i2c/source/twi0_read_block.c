@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_read_block.c
+// Description : Read a block of bytes from an addressed slave - TWI.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_read_block.c
+/// \brief  Receive a block of bytes in any master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Receive a block of bytes as a bus master.
+/// \details
+/// Access the already opened slave to read `length` bytes.
+/// Every byte but the last one is answered by 'ACK', the last one
+/// by 'NACK' to tell the slave that the transfer ends.
+/// The transfer ends early at any failure.
+/// Dedicated to TWI equipped devices.
+/// \param buffer receives the bytes read.
+/// \param length number of bytes to read.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type twi0_read_block(uint8_t *buffer, uint16_t length)
+{
+    while (length)
+    {
+        // Start reception; ACK all but the last byte.
+        if (--length)
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
+        else
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
+        // Wait until finished.
+        if (twi0_wait_for_twint())
+            break;
+        *buffer++ = I2C0_HW_DATA_REG;
+        switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+        {
+            case 0x50:  /* data successfully received, ACK sent */
+            case 0x58:  /* data successfully received, but no ACK sent */
+                continue;
+            case 0x38:  /* arbitration lost while sending ACK */
+                i2c0_failure_info |= I2C_ARBITRATION_LOST;
+                break;
+            case 0x00:
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+            default:
+                i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+        }
+        break;
+    }
+    return(i2c0_failure_info);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) */
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -34,26 +34,7 @@
 /// \returns Byte read from bus.
 uint8_t twi0_receive_byte_multi_master(uint8_t transferFollows)
 {
-    // Start reception; select ACK option.
-    if (transferFollows)
-        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
-    else
-        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
-    // Wait until finished.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
-    uint8_t dataByte = I2C0_HW_DATA_REG;
-    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
-    {
-        case 0x50:  /* data successfully received, ACK sent */
-        case 0x58:  /* data successfully received, but no ACK sent */
-            i2c0_failure_info = I2C_SUCCESS;
-            break;
-        case 0x00:
-            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
-        default:
-            i2c0_failure_info = I2C_PROTOCOL_FAIL;
-    }
-    return(dataByte);
+    return(twi0_receive_byte_multi_master_inline(transferFollows));
 }
 
-#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) */
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
@@ -16,14 +16,37 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
 #include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// Events of the slave reception, see TWI0_STATUS_INDEX().
+enum TWI0_RECEIVE_SLAVE_EVENT_type
+{
+    TWI0_RECEIVE_SLAVE_OTHER = 0,
+    TWI0_RECEIVE_SLAVE_STOPPED,
+    TWI0_RECEIVE_SLAVE_NACKED,
+    TWI0_RECEIVE_SLAVE_ACKED,
+    TWI0_RECEIVE_SLAVE_BUS_ERROR
+};
+
+static const uint8_t twi0_receive_slave_event[32] PROGMEM =
+{
+    [TWI0_STATUS_INDEX(0xA0)] = TWI0_RECEIVE_SLAVE_STOPPED,     /* STOP or repeated START condition */
+    [TWI0_STATUS_INDEX(0x88)] = TWI0_RECEIVE_SLAVE_NACKED,      /* addressed, last byte received not ACKed */
+    [TWI0_STATUS_INDEX(0x98)] = TWI0_RECEIVE_SLAVE_NACKED,      /* general call, last byte received not ACKed */
+    [TWI0_STATUS_INDEX(0x80)] = TWI0_RECEIVE_SLAVE_ACKED,       /* addressed, last byte received with ACK */
+    [TWI0_STATUS_INDEX(0x90)] = TWI0_RECEIVE_SLAVE_ACKED,       /* general call, last byte received with ACK */
+    [TWI0_STATUS_INDEX(0x00)] = TWI0_RECEIVE_SLAVE_BUS_ERROR    /* Bus error (illegal START or STOP) */
+};
 
 /// \brief
 /// Receive one byte as a slave device.
 /// \details
 /// Receive one byte from the master when addressed as slave device.
 /// Dedicated to TWI equipped devices.
+/// The status codes are dispatched by a table in flash.
 ///
 /// \todo
 /// The slave is expected to always send an 'ACK' answer. ??
@@ -41,19 +64,18 @@ uint8_t twi0_receive_byte_slave(uint8_t sendAck)
     else
         I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
     // Wait until finished.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+    if (twi0_wait_for_twint())
+        return(0xFF);
     uint8_t dataByte = I2C0_HW_DATA_REG;
-    switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+    switch (TWI0_STATUS_EVENT(twi0_receive_slave_event))
     {
-        case 0xA0:  /* STOP or repeated START condition */
+        case TWI0_RECEIVE_SLAVE_STOPPED:
             i2c0_failure_info |= I2C_STOPPED;
-        case 0x88:  /* addressed, last byte received not ACKed */
-        case 0x98:  /* general call, last byte received not ACKed */
+        case TWI0_RECEIVE_SLAVE_NACKED:
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | slaveAckControl;
-        case 0x80:  /* addressed, last byte received with ACK */
-        case 0x90:  /* general call, last byte received with ACK */
+        case TWI0_RECEIVE_SLAVE_ACKED:
             break;
-        case 0x00:
+        case TWI0_RECEIVE_SLAVE_BUS_ERROR:
             I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
         default:
             i2c0_failure_info |= I2C_PROTOCOL_FAIL;
@@ -62,4 +84,4 @@ uint8_t twi0_receive_byte_slave(uint8_t sendAck)
 }
 
 
-#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) */
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -42,7 +42,8 @@ uint8_t twi0_receive_byte_slave_multi_master(uint8_t transferFollows)
     else
         I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
     // Wait until finished.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+    if (twi0_wait_for_twint())
+        return(0xFF);
     uint8_t dataByte = I2C0_HW_DATA_REG;
     switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
     {
@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_select_speed.c
+// Description : Switch the bit rate generator to the speed of a slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_select_speed.c
+/// \brief  Programs TWBR and the prescaler for the slave to address next.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SPEED_SLAVES) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+// Bit rate and prescaler of each profile, computed at compile time by the
+// divisor logic of `I2C0_BITRATE`. A profile F_CPU is too slow for has no
+// `I2C0_SPEED_*` identifier, its entry is never used.
+static const uint8_t twi0_speed_table[4][2] PROGMEM =
+{
+    {I2C0_BITRATE,                    I2C0_PRESCALER},
+    {I2C0_BITRATE_OF(100000UL),       I2C0_PRESCALER_OF(100000UL)},
+    {I2C0_BITRATE_OF(400000UL),       I2C0_PRESCALER_OF(400000UL)},
+    {I2C0_BITRATE_OF(1000000UL),      I2C0_PRESCALER_OF(1000000UL)}
+};
+
+/// \brief
+/// Switches the bus speed to the profile of the slave.
+/// \details
+/// Called by `hardI2c0_openDevice()` before the START. Slaves without
+/// an entry of `hardI2c0_setSlaveSpeed()` run at `I2C0_SPEED_DEFAULT`.
+/// The registers are written only if the profile changes.
+/// Dedicated to TWI equipped devices.
+/// \param deviceAddress of the slave, the R/W-flag is ignored.
+void twi0_select_speed(uint8_t deviceAddress)
+{
+    uint8_t profile = I2C0_SPEED_DEFAULT;
+    uint8_t i;
+
+    deviceAddress &= ~I2C_READ_ACCESS;
+    for (i = 0; i < I2C0_HW_SPEED_SLAVES; i++)
+    {
+        if (i2c0_slave_speed[i].address == deviceAddress)
+        {
+            profile = i2c0_slave_speed[i].profile;
+            break;
+        }
+    }
+    if (profile == i2c0_speed_profile)
+        return;
+    i2c0_speed_profile = profile;
+    I2C0_HW_BITRATE_REG = pgm_read_byte(&twi0_speed_table[profile][0]);
+    I2C0_HW_STATUS_REG = pgm_read_byte(&twi0_speed_table[profile][1]);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SPEED_SLAVES) */
@@ -16,7 +16,8 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_TWI_H_INCLUDED) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
 #include <avr/io.h>
 
 /// \details
@@ -31,15 +32,11 @@
 /// *I²C bus* specification is similar and allows any receiver
 /// to send a NACK in case it cannot accept the data.
 /// \param dataByte gets sent out.
+/// \returns 0 if sent, ~0 if timed out, see `twi0_wait_for_twint()`.
 /// \todo Rework the ACK documentation.
-inline void twi0_send_byte(uint8_t dataByte)
+uint8_t twi0_send_byte(uint8_t dataByte)
 {
-    // Prepare data byte.
-    I2C0_HW_DATA_REG = dataByte;
-    // Start transmission, always expect ACK.
-    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
-    // Wait until finished.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+    return(twi0_send_byte_inline(dataByte));
 }
 
-#endif /* defined(I2C_HW_TWI_H_INCLUDED) */
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
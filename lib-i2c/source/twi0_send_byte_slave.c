@@ -16,7 +16,8 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
 #include <avr/io.h>
 
 /// \brief
@@ -44,7 +45,8 @@ void twi0_send_byte_slave(uint8_t dataByte, uint8_t expectAck)
     else
         I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT);
     // Wait until finished.
-    while (!(I2C0_HW_CONTROL_REG & (1 << TWINT))) {}
+    if (twi0_wait_for_twint())
+        return;
     switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
     {
         case 0xB8:  /* byte sent, ACK received */
@@ -64,4 +66,4 @@ void twi0_send_byte_slave(uint8_t dataByte, uint8_t expectAck)
 }
 
 
-#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) */
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) */
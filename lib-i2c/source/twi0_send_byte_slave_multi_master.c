@@ -29,7 +29,8 @@
 /// \param dataByte contains the byte to send to the master.
 void twi0_send_byte_slave_multi_master(uint8_t dataByte)
 {
-    twi0_send_byte(dataByte);
+    if (twi0_send_byte(dataByte))
+        return;
     switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
     {
         case 0xB8:  /* byte sent, ACK received */
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_set_slave_buffers.c
+// Description : Assign the buffers of the interrupt driven TWI slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_set_slave_buffers.c
+/// \brief  Assign the data buffers of the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/// \brief
+/// Assign the data buffers of the interrupt driven slave.
+/// \details
+/// Each transfer starts at the beginning of the buffers.
+/// Bytes written by the master beyond `rxSize` are answered by 'NACK',
+/// bytes read beyond `txSize` return 0xFF.
+/// The buffers may be changed any time, a transfer in progress keeps
+/// on using the ones it started with only if they are not changed.
+/// Dedicated to TWI equipped devices.
+/// \param rxBuffer receives the bytes written by the master.
+/// \param rxSize size of `rxBuffer`.
+/// \param txBuffer holds the bytes read by the master.
+/// \param txSize size of `txBuffer`.
+void twi0_set_slave_buffers(uint8_t *rxBuffer, uint8_t rxSize, uint8_t *txBuffer, uint8_t txSize)
+{
+    uint8_t sreg = SREG;
+    cli();
+    i2c0_slave.rxBuffer = rxBuffer;
+    i2c0_slave.rxSize = rxSize;
+    i2c0_slave.txBuffer = txBuffer;
+    i2c0_slave.txSize = txSize;
+    i2c0_slave.registerFile = 0;
+    SREG = sreg;
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
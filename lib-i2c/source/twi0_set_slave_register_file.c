@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_set_slave_register_file.c
+// Description : Assign a register file to the interrupt driven TWI slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_set_slave_register_file.c
+/// \brief  Assign a register file to the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/// \brief
+/// Assign a register file to the interrupt driven slave.
+/// \details
+/// The slave then behaves like a sensor style register map: the
+/// first byte of a write access sets the register pointer, any
+/// further bytes are stored to `registers` with auto-increment.
+/// A read access streams out the registers from the pointer on.
+/// The pointer wraps around at `size` and is kept between transfers,
+/// so a pointer write followed by a repeated START and a read returns
+/// the registers addressed.
+/// The reported byte count of a write access includes the pointer byte.
+/// Replaces any buffers assigned by `twi0_set_slave_buffers()`.
+/// Dedicated to TWI equipped devices.
+/// A register file of no registers is rejected, the slave is left as
+/// it is.
+/// \param registers RAM array serving as register file.
+/// \param size number of registers, at least 1.
+/// \returns 0 if rejected, else !=0.
+uint8_t twi0_set_slave_register_file(uint8_t *registers, uint8_t size)
+{
+    if (!registers || !size)
+        return(0);
+    uint8_t sreg = SREG;
+    cli();
+    i2c0_slave.rxBuffer = registers;
+    i2c0_slave.rxSize = size;
+    i2c0_slave.txBuffer = registers;
+    i2c0_slave.txSize = size;
+    i2c0_slave.pointer = 0;
+    i2c0_slave.registerFile = ~0;
+    SREG = sreg;
+    return(~0);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
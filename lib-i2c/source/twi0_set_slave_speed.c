@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_set_slave_speed.c
+// Description : Assign a speed profile to a slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_set_slave_speed.c
+/// \brief  Bus speed to use for a certain slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SPEED_SLAVES) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Assigns a speed profile to a slave, see `hardI2c0_setSlaveSpeed()`.
+/// \details
+/// Updates the entry of the slave if there is one already, else takes
+/// the first free entry.
+/// Dedicated to TWI equipped devices.
+/// \param deviceAddress of the slave, the R/W-flag is ignored.
+/// \param profile one of `I2C0_SPEED_DEFAULT`, `I2C0_SPEED_100k`,
+/// `I2C0_SPEED_400k` or `I2C0_SPEED_1M`.
+/// \returns 0 if all `I2C0_HW_SPEED_SLAVES` entries are taken, ~0 else.
+uint8_t twi0_set_slave_speed(uint8_t deviceAddress, uint8_t profile)
+{
+    struct I2C0_SLAVE_SPEED_type *entry = 0;
+    uint8_t i;
+
+    deviceAddress &= ~I2C_READ_ACCESS;
+    for (i = 0; i < I2C0_HW_SPEED_SLAVES; i++)
+    {
+        if (i2c0_slave_speed[i].address == deviceAddress)
+        {
+            entry = &i2c0_slave_speed[i];
+            break;
+        }
+        if (!entry && !i2c0_slave_speed[i].address)
+            entry = &i2c0_slave_speed[i];
+    }
+    if (!entry)
+        return(0);
+    entry->address = deviceAddress;
+    entry->profile = profile;
+    return(~0);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SPEED_SLAVES) */
@@ -25,6 +25,8 @@
 /// \details
 /// The hardware is set up for the predefined operation mode and
 /// parameters.
+/// The single master with `I2C0_HW_BUS_RECOVERY` frees SDA if a slave
+/// keeps it low, see `i2c0_recover_bus()`.
 /// Dedicated to TWI equipped devices.
 ///
 /// \param divider used to derive the bus frequency from prescaled
@@ -37,7 +39,18 @@ void twi0_setup_master(uint8_t divider, uint8_t prescaler)
 {
     I2C0_HW_BITRATE_REG = divider;
     I2C0_HW_STATUS_REG = prescaler;
+#if defined I2C0_HW_SPEED_SLAVES
+    i2c0_speed_profile = I2C0_SPEED_UNKNOWN;
+#endif
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_SETUP;
+#endif
     I2C0_ENABLE;
+#if defined I2C0_HW_BUS_RECOVERY && defined I2C0_HW_SINGLE_MASTER
+    // A slave reset within a byte may still keep SDA low.
+    if (I2C0_SDA_IS_LOW)
+        i2c0_recover_bus();
+#endif
 }
 
 
@@ -55,6 +55,9 @@ void twi0_setup_master_slave(uint8_t slaveAddress,
     // This is for master mode(s).
     I2C0_HW_BITRATE_REG = divider;
     I2C0_HW_STATUS_REG = prescaler;
+#if defined I2C0_HW_SPEED_SLAVES
+    i2c0_speed_profile = I2C0_SPEED_UNKNOWN;
+#endif
 //#endif
 //#if defined(I2C0_HW_AS_SLAVE)
     // This is for slave mode(s).
@@ -65,6 +68,9 @@ void twi0_setup_master_slave(uint8_t slaveAddress,
     slaveAckControl = (1 << TWEA);
 //#endif
     // This is for all modes.
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_SETUP;
+#endif
     I2C0_ENABLE;
 }
 
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -53,8 +53,11 @@ void twi0_setup_slave(uint8_t slaveAddress)
     I2C0_HW_SLAVE_ADDRESS_MASK = slaveMask;
 #endif
     slaveAckControl = (1 << TWEA);
+#if defined I2C0_HW_TIMEOUT_TIMER1
+    I2C0_TIMEOUT_SETUP;
+#endif
     I2C0_ENABLE;
 }
 
 
-#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) */
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) */
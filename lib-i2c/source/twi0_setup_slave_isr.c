@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_setup_slave_isr.c
+// Description : TWI hardware setup for the interrupt driven slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_setup_slave_isr.c
+/// \brief  Initializes the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Initializes the interrupt driven slave.
+/// \details
+/// Sets up the TWI to respond to the address (range) and to raise an
+/// interrupt on every bus event concerning the slave.
+/// No buffers are assigned yet, so any byte written is answered by
+/// 'NACK' and reading returns 0xFF until `twi0_set_slave_buffers()` or
+/// `twi0_set_slave_register_file()` is called.
+/// Dedicated to TWI equipped devices.
+/// \note Interrupts need to be enabled globally (`sei()`).
+/// \param slaveAddress defines the address to respond to.
+/// If bit 0 is set the slave also answers to the 'general call'
+/// address (0).
+/// \param slaveMask excludes all bits *set* as invalid for the
+/// address comparison. `slaveMask` is omitted on devices without
+/// adequate hardware support (e. g. ATmega8).
+#ifndef I2C0_HW_NO_SLAVE_ADDRESS_MASK
+void twi0_setup_slave_isr(uint8_t slaveAddress, uint8_t slaveMask)
+#else
+void twi0_setup_slave_isr(uint8_t slaveAddress)
+#endif
+{
+    i2c0_slave.done = 0;
+    I2C0_HW_SLAVE_ADDRESS_REG = slaveAddress;
+#ifndef I2C0_HW_NO_SLAVE_ADDRESS_MASK
+    I2C0_HW_SLAVE_ADDRESS_MASK = slaveMask;
+#endif
+    slaveAckControl = (1 << TWEA);
+    I2C0_ENABLE;
+}
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
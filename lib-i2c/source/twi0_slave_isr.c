@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_slave_isr.c
+// Description : TWI interrupt, serves the interrupt driven slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_slave_isr.c
+/// \brief  Interrupt service routine of the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+// Events of the slave, see TWI0_STATUS_INDEX().
+enum TWI0_SLAVE_ISR_EVENT_type
+{
+    TWI0_SLAVE_ISR_OTHER = 0,
+    TWI0_SLAVE_ISR_ADDRESSED_W,
+    TWI0_SLAVE_ISR_RECEIVED,
+    TWI0_SLAVE_ISR_ADDRESSED_R,
+    TWI0_SLAVE_ISR_SENT,
+    TWI0_SLAVE_ISR_FINISHED,
+    TWI0_SLAVE_ISR_BUS_ERROR
+};
+
+static const uint8_t twi0_slave_isr_event[32] PROGMEM =
+{
+    [TWI0_STATUS_INDEX(0x60)] = TWI0_SLAVE_ISR_ADDRESSED_W,  /* own address + W received */
+    [TWI0_STATUS_INDEX(0x68)] = TWI0_SLAVE_ISR_ADDRESSED_W,  /* arbitration lost, own address + W received */
+    [TWI0_STATUS_INDEX(0x70)] = TWI0_SLAVE_ISR_ADDRESSED_W,  /* general call address received */
+    [TWI0_STATUS_INDEX(0x78)] = TWI0_SLAVE_ISR_ADDRESSED_W,  /* arbitration lost, general call address received */
+    [TWI0_STATUS_INDEX(0x80)] = TWI0_SLAVE_ISR_RECEIVED,     /* data received, ACK returned */
+    [TWI0_STATUS_INDEX(0x90)] = TWI0_SLAVE_ISR_RECEIVED,     /* general call data received, ACK returned */
+    [TWI0_STATUS_INDEX(0xA8)] = TWI0_SLAVE_ISR_ADDRESSED_R,  /* own address + R received */
+    [TWI0_STATUS_INDEX(0xB0)] = TWI0_SLAVE_ISR_ADDRESSED_R,  /* arbitration lost, own address + R received */
+    [TWI0_STATUS_INDEX(0xB8)] = TWI0_SLAVE_ISR_SENT,         /* data sent, ACK received */
+    [TWI0_STATUS_INDEX(0x88)] = TWI0_SLAVE_ISR_FINISHED,     /* data received, NACK returned */
+    [TWI0_STATUS_INDEX(0x98)] = TWI0_SLAVE_ISR_FINISHED,     /* general call data received, NACK returned */
+    [TWI0_STATUS_INDEX(0xA0)] = TWI0_SLAVE_ISR_FINISHED,     /* STOP or repeated START received */
+    [TWI0_STATUS_INDEX(0xC0)] = TWI0_SLAVE_ISR_FINISHED,     /* data sent, NACK received */
+    [TWI0_STATUS_INDEX(0xC8)] = TWI0_SLAVE_ISR_FINISHED,     /* last data sent, ACK received */
+    [TWI0_STATUS_INDEX(0x00)] = TWI0_SLAVE_ISR_BUS_ERROR     /* bus error */
+};
+
+/// \brief
+/// TWI interrupt. Moves the bytes of a slave transfer.
+/// \details
+/// Each bus event is handled according to the TWI status code. Bytes
+/// written by the master are stored to the receive buffer, bytes read
+/// are taken from the transmit buffer - or both from the register file
+/// if one is assigned. A finished transfer is handed over to
+/// `twi0_slave_transfer_done()`.
+/// The status codes are dispatched by a table in flash, this keeps the
+/// time SCL is stretched short.
+/// Dedicated to TWI equipped devices.
+ISR(TWI_vect)
+{
+    uint8_t dataByte;
+    switch (TWI0_STATUS_EVENT(twi0_slave_isr_event))
+    {
+        case TWI0_SLAVE_ISR_ADDRESSED_W:
+            i2c0_slave.addressReceived = I2C0_HW_DATA_REG;
+            i2c0_slave.count = 0;
+            i2c0_slave.pointerReceived = 0;
+            i2c0_slave.state = ~0;
+            TWI0_SLAVE_CONTINUE(i2c0_slave.registerFile || i2c0_slave.rxSize);
+            return;
+        case TWI0_SLAVE_ISR_RECEIVED:
+            dataByte = I2C0_HW_DATA_REG;
+            if (i2c0_slave.registerFile)
+            {
+                // First byte sets the register pointer, the following
+                // ones are stored with auto-increment.
+                if (i2c0_slave.pointerReceived)
+                    i2c0_slave.rxBuffer[i2c0_slave.pointer++] = dataByte;
+                else
+                {
+                    i2c0_slave.pointer = dataByte;
+                    i2c0_slave.pointerReceived = ~0;
+                }
+                if (i2c0_slave.pointer >= i2c0_slave.rxSize)
+                    i2c0_slave.pointer = 0;
+                i2c0_slave.count++;
+                TWI0_SLAVE_CONTINUE(~0);
+            }
+            else
+            {
+                i2c0_slave.rxBuffer[i2c0_slave.count++] = dataByte;
+                // NACK the byte exceeding the buffer.
+                TWI0_SLAVE_CONTINUE(i2c0_slave.count < i2c0_slave.rxSize);
+            }
+            return;
+        case TWI0_SLAVE_ISR_ADDRESSED_R:
+            i2c0_slave.addressReceived = I2C0_HW_DATA_REG;
+            i2c0_slave.count = 0;
+            i2c0_slave.state = ~0;
+        case TWI0_SLAVE_ISR_SENT:
+            if (i2c0_slave.registerFile)
+            {
+                // Stream out from the register pointer.
+                I2C0_HW_DATA_REG = i2c0_slave.txBuffer[i2c0_slave.pointer++];
+                if (i2c0_slave.pointer >= i2c0_slave.txSize)
+                    i2c0_slave.pointer = 0;
+            }
+            else if (i2c0_slave.count < i2c0_slave.txSize)
+                I2C0_HW_DATA_REG = i2c0_slave.txBuffer[i2c0_slave.count];
+            else
+                I2C0_HW_DATA_REG = 0xFF;
+            i2c0_slave.count++;
+            TWI0_SLAVE_CONTINUE(~0);
+            return;
+        case TWI0_SLAVE_ISR_FINISHED:
+            if (i2c0_slave.state)
+            {
+                TWI0_SLAVE_TRANSFER_FINISHED;
+            }
+            break;
+        case TWI0_SLAVE_ISR_BUS_ERROR:
+            I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+            return;
+        default:
+            break;
+    }
+    // Not (longer) addressed, recognize own address again.
+    i2c0_slave.state = 0;
+    TWI0_SLAVE_CONTINUE(~0);
+}
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_start_transaction.c
+// Description : Submit a transaction to the interrupt driven TWI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_start_transaction.c
+/// \brief  Non-blocking start of a complete master transaction.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Submit a transaction to the interrupt driven master.
+/// \details
+/// The failure code(s) are reported to the internal status record and
+/// read back by `twi0_check4Error()`, see `hardI2c0_submitTransaction()`.
+/// With `I2C0_HW_QUEUE_SIZE` a second transaction is refused while the
+/// first is pending, it would take over the one status record.
+/// Dedicated to TWI equipped devices.
+/// \param deviceAddress defines which slave to access. The R/W-flag is
+/// ignored, it is derived from the counts.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read.
+/// \returns 0 if the previous transaction still runs, ~0 if accepted.
+uint8_t twi0_start_transaction(uint8_t deviceAddress,
+                               uint8_t *writeBuffer,
+                               uint16_t writeCount,
+                               uint8_t *readBuffer,
+                               uint16_t readCount)
+{
+#if defined I2C0_HW_QUEUE_SIZE
+    if (i2c0_status.pending)
+        return(0);
+#endif
+    return(hardI2c0_submitTransaction(deviceAddress, writeBuffer, writeCount,
+                                      readBuffer, readCount, &i2c0_status));
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
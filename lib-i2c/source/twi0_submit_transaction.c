@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_submit_transaction.c
+// Description : Submit a transaction with its own status record to the
+//               interrupt driven TWI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_submit_transaction.c
+/// \brief  Non-blocking start of a complete master transaction, status
+/// reported to a record of the caller.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) && !defined(I2C0_HW_QUEUE_SIZE) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Submit a transaction to the interrupt driven master.
+/// \details
+/// Stores the transaction for the TWI interrupt and asserts the start
+/// condition. Everything else is done by the interrupt, which reports
+/// to `status`: the failure code(s) as they occur, `pending` cleared
+/// when the transaction is done.
+/// Dedicated to TWI equipped devices.
+/// \param deviceAddress defines which slave to access. The R/W-flag is
+/// ignored, it is derived from the counts.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read.
+/// \param status receives the outcome of the transaction.
+/// \returns 0 if the previous transaction still runs, ~0 if accepted.
+uint8_t twi0_submit_transaction(uint8_t deviceAddress,
+                                uint8_t *writeBuffer,
+                                uint16_t writeCount,
+                                uint8_t *readBuffer,
+                                uint16_t readCount,
+                                struct I2C_STATUS_type *status)
+{
+    // TWIE stays set until the interrupt has finished the previous one.
+    if (I2C0_HW_CONTROL_REG & (1 << TWIE))
+        return(0);
+    deviceAddress &= ~I2C_READ_ACCESS;
+    // Read only: address for reading right from the beginning.
+    if (!writeCount && readCount)
+        deviceAddress |= I2C_READ_ACCESS;
+    i2c0_transaction.deviceAddress = deviceAddress;
+    i2c0_transaction.writeBuffer = writeBuffer;
+    i2c0_transaction.writeCount = writeCount;
+    i2c0_transaction.readBuffer = readBuffer;
+    i2c0_transaction.readCount = readCount;
+    i2c0_transaction.status = status;
+    status->failure = I2C_SUCCESS;
+    status->pending = ~0;
+    // Clear previous failures.
+    i2c0_failure_info = I2C_SUCCESS;
+    // Assert start condition, the interrupt takes over.
+    I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWSTA);
+    return(~0);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) && !defined(I2C0_HW_QUEUE_SIZE) */
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_submit_transaction_queued.c
+// Description : Queue a transaction for the interrupt driven TWI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_submit_transaction_queued.c
+/// \brief  Non-blocking start of a complete master transaction, queued
+/// behind the ones still running.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) && defined(I2C0_HW_QUEUE_SIZE) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Queue a transaction for the interrupt driven master.
+/// \details
+/// Stores the transaction to the head of `i2c0_queue`. The TWI interrupt
+/// starts it as soon as the transactions queued before are done, without
+/// returning to the application in between. If the master is idle the
+/// transaction is started here.
+/// Interrupts stay enabled: the head is advanced after the slot is
+/// filled, the interrupt only reads it.
+/// Dedicated to TWI equipped devices.
+/// \param deviceAddress defines which slave to access. The R/W-flag is
+/// ignored, it is derived from the counts.
+/// \param writeBuffer holds the bytes to send.
+/// \param writeCount number of bytes to send.
+/// \param readBuffer receives the bytes read.
+/// \param readCount number of bytes to read.
+/// \param status receives the outcome of the transaction.
+/// \returns 0 if the queue is full, ~0 if accepted.
+uint8_t twi0_submit_transaction_queued(uint8_t deviceAddress,
+                                       uint8_t *writeBuffer,
+                                       uint16_t writeCount,
+                                       uint8_t *readBuffer,
+                                       uint16_t readCount,
+                                       struct I2C_STATUS_type *status)
+{
+    uint8_t head = i2c0_queue_head;
+    uint8_t next = (head + 1) & (I2C0_HW_QUEUE_SIZE - 1);
+
+    if (next == i2c0_queue_tail)
+        return(0);
+    deviceAddress &= ~I2C_READ_ACCESS;
+    // Read only: address for reading right from the beginning.
+    if (!writeCount && readCount)
+        deviceAddress |= I2C_READ_ACCESS;
+    i2c0_queue[head].deviceAddress = deviceAddress;
+    i2c0_queue[head].writeBuffer = writeBuffer;
+    i2c0_queue[head].writeCount = writeCount;
+    i2c0_queue[head].readBuffer = readBuffer;
+    i2c0_queue[head].readCount = readCount;
+    i2c0_queue[head].status = status;
+    status->failure = I2C_SUCCESS;
+    status->pending = ~0;
+    i2c0_queue_head = next;
+    // An idle master has run the queue empty, the tail is this slot.
+    // TWIE stays set while the interrupt works the queue.
+    if (!(I2C0_HW_CONTROL_REG & (1 << TWIE)))
+    {
+        i2c0_transaction = i2c0_queue[i2c0_queue_tail];
+        i2c0_failure_info = I2C_SUCCESS;
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWIE) | (1 << TWINT) | (1 << TWSTA);
+    }
+    return(~0);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) && defined(I2C0_HW_QUEUE_SIZE) */
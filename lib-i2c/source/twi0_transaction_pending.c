@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_transaction_pending.c
+// Description : Poll the interrupt driven TWI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_transaction_pending.c
+/// \brief  Check if a submitted transaction still runs.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Indicate if the interrupt driven master is busy.
+/// \details
+/// The TWI interrupt stays enabled as long as a transaction runs.
+/// Dedicated to TWI equipped devices.
+/// \returns 0 if done, !=0 if the transaction still runs.
+uint8_t twi0_transaction_pending(void)
+{
+    return(I2C0_HW_CONTROL_REG & (1 << TWIE));
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
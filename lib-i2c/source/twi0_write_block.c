@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : twi0_write_block.c
+// Description : Write a block of bytes to an addressed slave - TWI.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   twi0_write_block.c
+/// \brief  Submit a block of bytes in any master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Submit a block of bytes as a bus master.
+/// \details
+/// Access the already adressed slave to write `length` bytes.
+/// The bytes are moved within one loop straight to the TWI registers.
+/// The transfer ends early at the first byte not acknowledged or any
+/// other failure.
+/// Dedicated to TWI equipped devices.
+/// \param buffer holds the bytes to send.
+/// \param length number of bytes to send.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type twi0_write_block(const uint8_t *buffer, uint16_t length)
+{
+    while (length--)
+    {
+        // Prepare data byte.
+        I2C0_HW_DATA_REG = *buffer++;
+        // Start transmission, expect ACK.
+        I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWEA);
+        // Wait until finished.
+        if (twi0_wait_for_twint())
+            break;
+        switch (I2C0_HW_STATUS_REG & (0b11111<<TWS3))
+        {
+            case 0x28:  /* data successfully sent */
+                continue;
+            case 0x30:  /* data sent, but no ACK received */
+                i2c0_failure_info |= I2C_NO_ACK;
+                break;
+            case 0x38:  /* arbitration lost while sending data */
+                i2c0_failure_info |= I2C_ARBITRATION_LOST;
+                break;
+            case 0x00:
+                I2C0_HW_CONTROL_REG = (1 << TWEN) | (1 << TWINT) | (1 << TWSTO) | slaveAckControl;
+            default:
+                i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+        }
+        break;
+    }
+    return(i2c0_failure_info);
+}
+
+
+#endif /* defined(I2C_HW_TWI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) */
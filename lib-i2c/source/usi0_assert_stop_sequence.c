@@ -16,9 +16,9 @@
 
 
 #include "i2c_hw.h"
-#if defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
 #include <avr/io.h>
-#include <util/delay.h>
 
 
 /// \brief
@@ -29,15 +29,8 @@
 /// Dedicated to USI equipped devices.
 void usi0_assert_stop_sequence(void)
 {
-    USI0_PULL_SDA;
-    USI0_SDA_DRIVER_ENABLE;
-    USI0_HALFBIT_DELAY;
-    I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
-    USI0_RELEASE_SCL;
-    while(I2C0_SCL_IS_LOW) {}
-    USI0_HALFBIT_DELAY;
-    USI0_SDA_DRIVER_DISABLE;
+    usi0_assert_stop_sequence_inline();
 }
 
 
-#endif /* defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) */
+#endif /* defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
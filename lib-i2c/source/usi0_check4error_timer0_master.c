@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_check4error_timer0_master.c
+// Description : Report status of the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_check4error_timer0_master.c
+/// \brief  Report the status of the last bus access.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Report the last bus transaction status (single master, Timer0
+/// clocked).
+/// \details
+/// Waits for the byte in progress to finish since its status is not
+/// known before.
+/// Dedicated to USI equipped devices.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type usi0_check4error_timer0_master(void)
+{
+    usi0_wait_until_done_timer0_master();
+    return(i2c0_failure_info);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
@@ -19,7 +19,6 @@
 #if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_SINGLE_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
-#include <util/delay.h>
 
 /// \brief
 /// Start access to a certain slave. Valid for any multi master bus
@@ -49,7 +48,7 @@ enum I2C_FAILURE_type usi0_open_device_multi_master(uint8_t deviceAddress)
         return(i2c0_failure_info);
     // Prepare SCL for a (RE)START sequence.
     USI0_SDA_DRIVER_DISABLE;
-    USI0_HALFBIT_DELAY;
+    USI0_LOW_PHASE_DELAY;
     I2C0_HW_CONTROL_REG = USI_HOLD_ON_START | USI_SAMPLE_ON_FALLING_EDGE;
     USI0_RELEASE_SCL;
     while(I2C0_SCL_IS_LOW)
@@ -59,10 +58,10 @@ enum I2C_FAILURE_type usi0_open_device_multi_master(uint8_t deviceAddress)
         if (I2C0_HW_STATUS_REG & (1 << USISIF))
             break;
     }
-    USI0_HALFBIT_DELAY;
+    USI0_HIGH_PHASE_DELAY;
     USI0_PULL_SDA;
     USI0_SDA_DRIVER_ENABLE;
-    USI0_HALFBIT_DELAY;
+    USI0_HIGH_PHASE_DELAY;
     USI0_PULL_SCL;
     i2c0_failure_info = I2C_RESTARTED;
     usi0_send_byte_multi_master(deviceAddress);
@@ -16,7 +16,8 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
 #include <avr/io.h>
 #include <util/delay.h>
 
@@ -26,6 +27,8 @@
 /// \details
 /// Asserts a start sequence to the bus, followed by the slave
 /// address.
+/// With `I2C0_HW_BUS_RECOVERY` a slave keeping SDA low gets clocked
+/// out first, see `i2c0_recover_bus()`.
 /// Dedicated to USI equipped devices.
 /// \param deviceAddress defines which slave to access. It shall
 /// define the READ or WRITE mode also.
@@ -42,7 +45,7 @@ enum I2C_FAILURE_type usi0_open_device_single_master(uint8_t deviceAddress)
 {
     // Prepare SCL for a (RE)START sequence.
     USI0_SDA_DRIVER_DISABLE;
-    USI0_HALFBIT_DELAY;
+    USI0_LOW_PHASE_DELAY;
     USI0_RELEASE_SCL;
 //  while(I2C0_SCL_IS_LOW)
 //  { // wait for SCL to rise - slow devices block SCL as wait condition
@@ -51,14 +54,19 @@ enum I2C_FAILURE_type usi0_open_device_single_master(uint8_t deviceAddress)
 //      if (I2C0_HW_STATUS_REG & (1 << USISIF))
 //          break;
 //  }
-    USI0_HALFBIT_DELAY;
+    USI0_HIGH_PHASE_DELAY;
+#if defined I2C0_HW_BUS_RECOVERY
+    // Nobody else drives SDA low on an idle bus.
+    if (I2C0_SDA_IS_LOW && i2c0_recover_bus())
+        return(i2c0_failure_info);
+#endif
     // ===> Check that no other master gave a START sequence meanwhile.
     if (!(I2C0_HW_STATUS_REG & (1 << USISIF)))
     {
         // Assert start condition.
         USI0_PULL_SDA;
         USI0_SDA_DRIVER_ENABLE;
-        USI0_HALFBIT_DELAY;
+        USI0_HIGH_PHASE_DELAY;
         USI0_PULL_SCL;
         // IMPORTANT:
         // Start condition detector needs ample reaction time (50ns..300ns).
@@ -86,4 +94,4 @@ enum I2C_FAILURE_type usi0_open_device_single_master(uint8_t deviceAddress)
 }
 
 
-#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) */
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) */
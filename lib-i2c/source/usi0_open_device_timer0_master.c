@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_open_device_timer0_master.c
+// Description : Address one slave using the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_open_device_timer0_master.c
+/// \brief  Start accessing a certain slave in the Timer0 clocked single master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <util/delay.h>
+
+
+/// \brief
+/// Start access to a certain slave. Valid for a single bus master,
+/// Timer0 clocked.
+/// \details
+/// Asserts a start sequence to the bus, followed by the slave
+/// address. The start sequence is done by software, the address
+/// field by the interrupts. Waits until the address is acknowledged
+/// or not.
+/// Dedicated to USI equipped devices.
+/// \param deviceAddress defines which slave to access. It shall
+/// define the READ or WRITE mode also.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type usi0_open_device_timer0_master(uint8_t deviceAddress)
+{
+    usi0_wait_until_done_timer0_master();
+    // Prepare SCL for a (RE)START sequence.
+    I2C0_HW_DATA_REG = 0xFF;
+    USI0_SDA_DRIVER_DISABLE;
+    USI0_LOW_PHASE_DELAY;
+    USI0_RELEASE_SCL;
+    while (I2C0_SCL_IS_LOW) {}
+    USI0_HIGH_PHASE_DELAY;
+    // Assert start condition.
+    USI0_PULL_SDA;
+    USI0_SDA_DRIVER_ENABLE;
+    USI0_HIGH_PHASE_DELAY;
+    USI0_PULL_SCL;
+    // Start condition detector needs ample reaction time, see
+    // usi0_open_device_single_master().
+    _delay_us(1);
+    USI0_RELEASE_SDA;
+    I2C0_HW_CONTROL_REG = USI0_TIMER0_MASTER_MODE;
+    // Clear previous failures.
+    i2c0_failure_info = I2C_SUCCESS;
+    // Clear START just generated but also STOP from previous bus cycles.
+    I2C0_HW_STATUS_REG = (1 << USISIF) | (1 << USIPF);
+    usi0_send_byte_timer0_master(deviceAddress);
+    usi0_wait_until_done_timer0_master();
+    return(i2c0_failure_info);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
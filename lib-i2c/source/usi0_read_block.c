@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_read_block.c
+// Description : Read a block of bytes from an addressed slave - USI.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_read_block.c
+/// \brief  Receive a block of bytes in any master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+
+#if !defined I2C0_HW_TIMER0_CLOCKED
+// The byte loop of the block, `calibrated` a constant. The byte body gets
+// inlined twice: with the 'ACK' for all but the last byte and with the
+// 'NACK' for the last one, no reply to decide per byte.
+USI0_INLINE void usi0_read_block_timed(uint8_t *buffer, uint16_t length, uint8_t calibrated)
+{
+    if (!length)
+        return;
+    while (--length)
+    {
+        *buffer++ = usi0_receive_byte_any_master_timed_inline(1, calibrated);
+        if (i2c0_failure_info)
+            return;
+    }
+    *buffer = usi0_receive_byte_any_master_timed_inline(0, calibrated);
+}
+#endif
+
+
+/// \brief
+/// Receive a block of bytes as a bus master.
+/// \details
+/// Access the already opened slave to read `length` bytes.
+/// Every byte but the last one is answered by 'ACK', the last one
+/// by 'NACK' to tell the slave that the transfer ends.
+/// The transfer ends early at any failure.
+/// The masters clocked by software run the byte body inline, the Timer0
+/// clocked master receives byte by byte and waits for the last byte to
+/// finish, its status is reported as well.
+/// Dedicated to USI equipped devices.
+/// \param buffer receives the bytes read.
+/// \param length number of bytes to read.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type usi0_read_block(uint8_t *buffer, uint16_t length)
+{
+#if defined I2C0_HW_TIMER0_CLOCKED
+    while (length)
+    {
+        // ACK all but the last byte.
+        length--;
+        *buffer++ = hardI2c0_getByteAsMaster(length);
+        if (i2c0_failure_info)
+            break;
+    }
+#else
+    if (USI0_PHASES_CALIBRATED)
+        usi0_read_block_timed(buffer, length, 1);
+    else
+        usi0_read_block_timed(buffer, length, 0);
+#endif
+    return(hardI2c0_check4Error());
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) */
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -35,27 +35,8 @@
 /// \returns Byte read from bus.
 uint8_t usi0_receive_byte_any_master(uint8_t transferFollows)
 {
-    USI0_SDA_DRIVER_DISABLE;
-    I2C0_HW_CONTROL_REG = USI_HOLD_ON_ALL | USI_SAMPLE_ON_FALLING_EDGE;
-    for (uint8_t bitcount=0; bitcount<8; bitcount++)
-    {
-        usi0_wait_until_bit_done_as_multimaster();
-        if (i2c0_failure_info & I2C_PROTOCOL_FAIL)
-            return(0);
-    }
-    uint8_t dataByte = I2C0_HW_DATA_REG;
-    // Prepare ACK or NACK reply and send it.
-    if (transferFollows)
-    {
-        USI0_PULL_SDA;
-        USI0_SDA_DRIVER_ENABLE;
-    }
-    usi0_wait_until_bit_done_as_multimaster();
-    USI0_SDA_DRIVER_DISABLE;
-    if (!transferFollows && (!(I2C0_HW_DATA_REG & 0x01)))
-        i2c0_failure_info = I2C_ARBITRATION_LOST | I2C_NO_ACK;
-    return(dataByte);
+    return(usi0_receive_byte_any_master_inline(transferFollows));
 }
 
 
-#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) */
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
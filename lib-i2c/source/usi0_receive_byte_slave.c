@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -59,4 +59,4 @@ uint8_t usi0_receive_byte_slave(uint8_t sendAck)
 }
 
 
-#endif /* defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) */
+#endif /* defined (I2C_HW_USI_H_INCLUDED) && defined (I2C0_HW_AS_SLAVE) && !defined (I2C0_HW_INTERRUPT_DRIVEN) */
@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_receive_byte_timer0_master.c
+// Description : Receive one byte by the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_receive_byte_timer0_master.c
+/// \brief  Receive one byte in the Timer0 clocked single master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Receive one byte as a bus master (single master, Timer0 clocked).
+/// \details
+/// Access the already opened slave to read one byte.
+/// The byte and the ACK or NACK reply are transferred by the interrupts.
+/// Since the byte is returned this waits until it is received.
+/// Dedicated to USI equipped devices.
+/// \param transferFollows sends an 'ACK' to the bus if set (!=0).
+/// \returns Byte read from bus.
+uint8_t usi0_receive_byte_timer0_master(uint8_t transferFollows)
+{
+    usi0_wait_until_done_timer0_master();
+    USI0_SDA_DRIVER_DISABLE;
+    if (transferFollows)
+        i2c0_bit_engine_state = USI0_TIMER0_RX_DATA_ACK;
+    else
+        i2c0_bit_engine_state = USI0_TIMER0_RX_DATA_NACK;
+    // Count both SCL edges of 8 bits.
+    I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+    USI0_TIMER0_START;
+    usi0_wait_until_done_timer0_master();
+    return(i2c0_received_byte);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
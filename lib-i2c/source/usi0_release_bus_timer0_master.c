@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_release_bus_timer0_master.c
+// Description : Release the bus by the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_release_bus_timer0_master.c
+/// \brief  Timer0 clocked version of "bus release".
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Release the bus (single master, Timer0 clocked).
+/// \details
+/// Waits for the byte in progress to finish, then sends a STOP
+/// condition to the bus.
+/// Dedicated to USI equipped devices.
+void usi0_release_bus_timer0_master(void)
+{
+    usi0_wait_until_done_timer0_master();
+    usi0_assert_stop_sequence();
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_send_byte_timer0_master.c
+// Description : Send one byte by the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_send_byte_timer0_master.c
+/// \brief  Submit one byte in the Timer0 clocked single master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Submit one byte as a bus master (single master, Timer0 clocked).
+/// \details
+/// Access the already adressed slave to write one byte.
+/// Waits for the previous byte to finish, then hands the byte over to
+/// the interrupts and returns. The CPU is free while the byte is
+/// transferred.
+/// If the previous byte failed - e.g. it was not acknowledged - the byte
+/// is dropped.
+/// Dedicated to USI equipped devices.
+/// \param dataByte gets sent out.
+void usi0_send_byte_timer0_master(uint8_t dataByte)
+{
+    usi0_wait_until_done_timer0_master();
+    if (i2c0_failure_info)
+        return;
+    // Prepare data byte, MSB shows up at SDA immediately.
+    I2C0_HW_DATA_REG = dataByte;
+    USI0_SDA_DRIVER_ENABLE;
+    i2c0_bit_engine_state = USI0_TIMER0_TX_DATA;
+    // Count both SCL edges of 8 bits.
+    I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+    USI0_TIMER0_START;
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_set_speed.c
+// Description : Bus speed of the USI master chosen at runtime.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_set_speed.c
+/// \brief  Calibrates the SCL delay loops for a bus frequency.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_RUNTIME_SPEED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Sets the bus frequency of the USI master, see `hardI2c0_setBusSpeed()`.
+/// \details
+/// Takes the bit time like the TWI, 16 + 2 * bitrate * 4^prescaler CPU
+/// cycles. At the bit time of `F_I2C0_HW` or shorter the bit loops run
+/// their compile time timing. Else the low phase waits by an 8 bit delay
+/// loop in steps of 3 cycles, the high phase by a 16 bit one in steps of
+/// 4 cycles, the code of the bit loops taken off. The low phase keeps
+/// the minimum t<SUB>LOW</SUB> and half of the bit time at least, the high
+/// phase the minimum t<SUB>HIGH</SUB> and the rest of the bit time. Of the
+/// next 4 low phase counts the one giving the shortest bit time is taken,
+/// the steps of 3 and 4 cycles combined this hits the bit time within a
+/// cycle mostly. The low phase takes 255 iterations at most, the high
+/// phase waits what exceeds.
+/// Dedicated to USI equipped devices.
+/// \param bitrate as with the TWI, e.g. `I2C0_BITRATE_OF(100000UL)`.
+/// \param prescaler as with the TWI, 0 to 3.
+void usi0_set_speed(uint8_t bitrate, uint8_t prescaler)
+{
+    uint16_t bitCycles = 16 + ((uint16_t)bitrate << (2 * (prescaler & 0x03) + 1));
+    uint16_t lowCycles = (bitCycles + 1) / 2;
+    uint16_t minLowCycles = I2C_MIN_LOW_CYCLES_STANDARD;
+    uint16_t minHighCycles = I2C_MIN_HIGH_CYCLES_STANDARD;
+    uint16_t bestCycles = 0xFFFF;
+    uint8_t lowLoops = 1;
+
+    if (bitCycles <= USI0_BIT_CYCLES)
+    {
+        i2c0_low_phase_loops = 0;
+        return;
+    }
+    if (bitCycles < (F_CPU / 100000UL))
+    {
+        minLowCycles = I2C_MIN_LOW_CYCLES_FAST;
+        minHighCycles = I2C_MIN_HIGH_CYCLES_FAST;
+    }
+    if (lowCycles < minLowCycles)
+        lowCycles = minLowCycles;
+    // Fewest loops reaching lowCycles.
+    if (lowCycles >= USI0_LOW_PHASE_LOOP_CYCLES(255))
+        lowLoops = 255;
+    else if (lowCycles > USI0_LOW_PHASE_LOOP_CYCLES(1))
+        lowLoops = (lowCycles - USI0_LOW_PHASE_LOOP_CYCLES(0) + 2) / 3;
+    for (uint8_t tries = 4; tries && lowLoops; tries--, lowLoops++)
+    {
+        uint16_t low = USI0_LOW_PHASE_LOOP_CYCLES(lowLoops);
+        uint16_t high = (bitCycles > low + minHighCycles) ? bitCycles - low : minHighCycles;
+        uint16_t highLoops = 1;
+
+        if (high > USI0_HIGH_PHASE_LOOP_CYCLES(1))
+            highLoops = (high - USI0_HIGH_PHASE_LOOP_CYCLES(0) + 3) / 4;
+        if (low + USI0_HIGH_PHASE_LOOP_CYCLES(highLoops) < bestCycles)
+        {
+            bestCycles = low + USI0_HIGH_PHASE_LOOP_CYCLES(highLoops);
+            i2c0_high_phase_loops = highLoops;
+            i2c0_low_phase_loops = lowLoops;
+        }
+    }
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_RUNTIME_SPEED) */
@@ -28,11 +28,25 @@
 /// parameters.
 /// Dedicated to USI equipped devices.
 ///
+/// \param bitrate with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
+/// \param prescaler with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
 /// \todo Check if this can get combined with the master+slave
 /// init.
 // Initialize the IO-lines, the bus and the USI-hardware.
-void usi0_setup_master(void)
+void usi0_setup_master(
+#if defined I2C0_HW_RUNTIME_SPEED
+                       uint8_t bitrate,
+                       uint8_t prescaler
+#else
+                       void
+#endif
+                       )
 {
+#if defined I2C0_HW_RUNTIME_SPEED
+    usi0_set_speed(bitrate, prescaler);
+#endif
     // setup does not disrupt any I²C transfer!
     I2C0_HW_DDR &= ~((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
     I2C0_HW_PORT |= ((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
@@ -16,7 +16,7 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) /*&& defined(I2C0_HW_AS_MASTER)*/ || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) /*&& defined(I2C0_HW_AS_MASTER)*/ && !defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
 #include "i2c_lib_private.h"
 #include <avr/io.h>
 
@@ -27,6 +27,10 @@
 /// parameters.
 /// Dedicated to USI equipped devices.
 ///
+/// \param bitrate with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
+/// \param prescaler with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
 /// \todo Check if this can get combined with the master-only init
 /// and the slave init. I think it can be done (prepared a little).
 /// \todo
@@ -35,8 +39,18 @@
 /// works and check application demos for code differences that
 /// shall not occur!
 // Initialize the IO-lines, the bus and the USI-hardware.
-void usi0_setup_master_slave(void)
+void usi0_setup_master_slave(
+#if defined I2C0_HW_RUNTIME_SPEED
+                             uint8_t bitrate,
+                             uint8_t prescaler
+#else
+                             void
+#endif
+                             )
 {
+#if defined I2C0_HW_RUNTIME_SPEED
+    usi0_set_speed(bitrate, prescaler);
+#endif
     // setup does not disrupt any I²C transfer!
     I2C0_HW_DDR &= ~((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
     I2C0_HW_PORT |= ((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
@@ -49,4 +63,4 @@ void usi0_setup_master_slave(void)
 }
 
 
-#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) */
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && !defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -17,7 +17,7 @@
 
 
 #include "i2c_hw.h"
-#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
 #include <avr/io.h>
 
 
@@ -26,20 +26,41 @@
 /// \details
 /// The hardware is set up for the predefined operation mode and
 /// parameters.
+/// With `I2C0_HW_BUS_RECOVERY` it frees SDA if a slave keeps it low,
+/// see `i2c0_recover_bus()`.
 /// Dedicated to USI equipped devices.
 ///
+/// \param bitrate with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
+/// \param prescaler with `I2C0_HW_RUNTIME_SPEED` only, see
+/// `usi0_set_speed()`.
 /// \todo Check if this can get combined with the master+slave
 /// init.
 // Initialize the IO-lines and the bus.
-void usi0_setup_single_master(void)
+void usi0_setup_single_master(
+#if defined I2C0_HW_RUNTIME_SPEED
+                              uint8_t bitrate,
+                              uint8_t prescaler
+#else
+                              void
+#endif
+                              )
 {
+#if defined I2C0_HW_RUNTIME_SPEED
+    usi0_set_speed(bitrate, prescaler);
+#endif
     // setup does not disrupt any I²C transfer!
     I2C0_HW_DDR &= ~((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
     I2C0_HW_PORT |= ((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
     // Enable SCL to drive the bus, SDA is kept recessive.
     I2C0_HW_STATUS_REG = (1<<USIOIF) | (1<<USISIF) | (1<<USIPF);
     I2C0_HW_DDR |= (1 << I2C0_HW_SCL_BIT);
+#if defined I2C0_HW_BUS_RECOVERY
+    // A slave reset within a byte may still keep SDA low.
+    if (I2C0_SDA_IS_LOW)
+        i2c0_recover_bus();
+#endif
 }
 
 
-#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) */
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && !defined(I2C0_HW_TIMER0_CLOCKED) */
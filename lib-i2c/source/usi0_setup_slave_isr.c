@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_setup_slave_isr.c
+// Description : USI hardware setup for the interrupt driven slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_setup_slave_isr.c
+/// \brief  Initializes the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Initializes the interrupt driven slave.
+/// \details
+/// Stores the address (range) to respond to and sets up the USI to
+/// raise an interrupt on every START condition.
+/// No buffers are assigned yet, so any byte written is answered by
+/// 'NACK' and reading returns 0xFF until `usi0_set_slave_buffers()` is
+/// called.
+/// Dedicated to USI equipped devices.
+/// \note Interrupts need to be enabled globally (`sei()`).
+/// \param slaveAddress assigned (base) address of the slave.
+/// \param slaveMask excludes all address bits *set* from the address
+/// comparison. If bit 0 is set the slave also answers to the
+/// 'general call' address (0).
+void usi0_setup_slave_isr(uint8_t slaveAddress, uint8_t slaveMask)
+{
+    i2c0_slave.address = slaveAddress;
+    i2c0_slave.mask = slaveMask;
+    i2c0_slave.state = USI0_SLAVE_IDLE;
+    i2c0_slave.done = 0;
+    // setup does not disrupt any I²C transfer!
+    I2C0_HW_DDR &= ~((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
+    I2C0_HW_PORT |= ((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
+    // Enable SCL to drive the bus, SDA is kept recessive.
+    I2C0_HW_STATUS_REG = (1<<USIOIF) | (1<<USISIF) | (1<<USIPF);
+    I2C0_HW_DDR |= (1 << I2C0_HW_SCL_BIT);
+    // Enable full slave response.
+    USI0_SLAVE_WAIT_FOR_START;
+    slaveAckControl = ~0;
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
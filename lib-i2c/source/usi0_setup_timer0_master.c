@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_setup_timer0_master.c
+// Description : USI hardware setup for the Timer0 clocked single master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_setup_timer0_master.c
+/// \brief  Initializes the Timer0 clocked bus master.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Initializes a master without any slave response, SCL clocked by Timer0.
+/// \details
+/// The IO-lines are set up as for `usi0_setup_single_master()`.
+/// Timer0 is set to CTC mode with a compare match every half bit time.
+/// The timer keeps running, its compare interrupt is enabled only while a
+/// byte is transferred.
+/// Dedicated to USI equipped devices.
+/// \note Interrupts need to be enabled globally (`sei()`).
+void usi0_setup_timer0_master(void)
+{
+    // setup does not disrupt any I²C transfer!
+    I2C0_HW_DDR &= ~((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
+    I2C0_HW_PORT |= ((1 << I2C0_HW_SDA_BIT) | ( 1 << I2C0_HW_SCL_BIT));
+    i2c0_bit_engine_state = USI0_TIMER0_IDLE;
+    // Half bit time base.
+    USI0_TIMER0_STOP;
+    I2C0_HW_TIMER_COMPARE_REG = USI0_TIMER0_COMPARE;
+    I2C0_HW_TIMER_MODE_REG = (1 << WGM01);
+    // Replace a clock select left by the application, keep the rest.
+    I2C0_HW_TIMER_CLOCK_REG = (I2C0_HW_TIMER_CLOCK_REG & ~USI0_TIMER0_CLOCK_SELECT) | USI0_TIMER0_PRESCALER;
+    // Enable SCL to drive the bus, SDA is kept recessive.
+    I2C0_HW_STATUS_REG = (1<<USIOIF) | (1<<USISIF) | (1<<USIPF);
+    I2C0_HW_DDR |= (1 << I2C0_HW_SCL_BIT);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
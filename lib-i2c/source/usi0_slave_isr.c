@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_slave_isr.c
+// Description : Interrupts of the interrupt driven USI slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_slave_isr.c
+/// \brief  Interrupt service routines of the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+
+/// \brief
+/// USI START condition interrupt.
+/// \details
+/// Ends a transfer in progress - this is a repeated START then - and
+/// prepares the reception of the address field.
+/// Dedicated to USI equipped devices.
+ISR(I2C0_HW_START_vect)
+{
+    if (i2c0_slave.state >= USI0_SLAVE_SEND_DATA)
+    {
+        USI0_SLAVE_TRANSFER_FINISHED;
+    }
+    USI0_SDA_DRIVER_DISABLE;
+    // Wait for SCL to fall and complete the START - or for a STOP.
+    while (I2C0_SCL_IS_HIGH && I2C0_SDA_IS_LOW) {}
+    if (I2C0_SDA_IS_LOW)
+    {
+        i2c0_slave.state = USI0_SLAVE_CHECK_ADDRESS;
+        USI0_SLAVE_TRANSFER_BITS(USI_SAMPLE_ON_FALLING_EDGE);
+    }
+    else
+    {
+        i2c0_slave.state = USI0_SLAVE_IDLE;
+        USI0_SLAVE_WAIT_FOR_START;
+    }
+    I2C0_HW_STATUS_REG = (1 << USISIF) | (1 << USIOIF) | (1 << USIPF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+}
+
+
+/// \brief
+/// USI counter overflow interrupt.
+/// \details
+/// Completes the address field, a data byte or an ACK bit and sets up
+/// the next one. SCL is held low by the USI meanwhile.
+/// Dedicated to USI equipped devices.
+ISR(I2C0_HW_OVERFLOW_vect)
+{
+    uint8_t dataByte;
+    switch (i2c0_slave.state)
+    {
+        case USI0_SLAVE_CHECK_ADDRESS:
+            dataByte = I2C0_HW_DATA_REG;
+            if (slaveAckControl &&
+                ((((dataByte ^ i2c0_slave.address) & ~i2c0_slave.mask & 0xFE) == 0) ||
+                    ((i2c0_slave.mask & 0x01) && !(dataByte & 0xFE)))
+               )
+            {
+                // Address matches, prepare ACK reply.
+                i2c0_slave.addressReceived = dataByte;
+                i2c0_slave.count = 0;
+                i2c0_slave.pointerReceived = 0;
+                if (dataByte & I2C_READ_ACCESS)
+                    i2c0_slave.state = USI0_SLAVE_SEND_DATA;
+                else
+                    i2c0_slave.state = USI0_SLAVE_REQUEST_DATA;
+                I2C0_HW_DATA_REG = 0x00;
+                USI0_SDA_DRIVER_ENABLE;
+                I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+                return;
+            }
+            break;
+        case USI0_SLAVE_CHECK_REPLY:
+            if (I2C0_HW_DATA_REG & 0x01)
+            {
+                // NACK, master reads no more.
+                USI0_SLAVE_TRANSFER_FINISHED;
+                break;
+            }
+            // ACK, send next byte.
+        case USI0_SLAVE_SEND_DATA:
+            if (i2c0_slave.registerFile)
+            {
+                // Stream out from the register pointer.
+                I2C0_HW_DATA_REG = i2c0_slave.txBuffer[i2c0_slave.pointer++];
+                if (i2c0_slave.pointer >= i2c0_slave.txSize)
+                    i2c0_slave.pointer = 0;
+            }
+            else if (i2c0_slave.count < i2c0_slave.txSize)
+                I2C0_HW_DATA_REG = i2c0_slave.txBuffer[i2c0_slave.count];
+            else
+                I2C0_HW_DATA_REG = 0xFF;
+            i2c0_slave.count++;
+            i2c0_slave.state = USI0_SLAVE_REQUEST_REPLY;
+            USI0_SLAVE_TRANSFER_BITS(USI_SAMPLE_ON_RISING_EDGE);
+            USI0_SDA_DRIVER_ENABLE;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+            return;
+        case USI0_SLAVE_REQUEST_REPLY:
+            // Release SDA for the master's ACK or NACK.
+            i2c0_slave.state = USI0_SLAVE_CHECK_REPLY;
+            USI0_SLAVE_TRANSFER_BITS(USI_SAMPLE_ON_FALLING_EDGE);
+            USI0_SDA_DRIVER_DISABLE;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+            return;
+        case USI0_SLAVE_REQUEST_DATA:
+            i2c0_slave.state = USI0_SLAVE_GET_DATA;
+            USI0_SDA_DRIVER_DISABLE;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BYTE_SLAVE;
+            return;
+        case USI0_SLAVE_GET_DATA:
+            dataByte = I2C0_HW_DATA_REG;
+            if (i2c0_slave.registerFile)
+            {
+                // First byte sets the register pointer, the following
+                // ones are stored with auto-increment.
+                if (i2c0_slave.pointerReceived)
+                    i2c0_slave.rxBuffer[i2c0_slave.pointer++] = dataByte;
+                else
+                {
+                    i2c0_slave.pointer = dataByte;
+                    i2c0_slave.pointerReceived = ~0;
+                }
+                if (i2c0_slave.pointer >= i2c0_slave.rxSize)
+                    i2c0_slave.pointer = 0;
+                i2c0_slave.count++;
+                i2c0_slave.state = USI0_SLAVE_REQUEST_DATA;
+                I2C0_HW_DATA_REG = 0x00;
+            }
+            else if (i2c0_slave.count < i2c0_slave.rxSize)
+            {
+                i2c0_slave.rxBuffer[i2c0_slave.count++] = dataByte;
+                i2c0_slave.state = USI0_SLAVE_REQUEST_DATA;
+                I2C0_HW_DATA_REG = 0x00;
+            }
+            else
+            {
+                // No room left, NACK.
+                i2c0_slave.state = USI0_SLAVE_RELEASE;
+                I2C0_HW_DATA_REG = 0xFF;
+            }
+            USI0_SDA_DRIVER_ENABLE;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+            return;
+        case USI0_SLAVE_RELEASE:
+            USI0_SLAVE_TRANSFER_FINISHED;
+            break;
+        default:
+            break;
+    }
+    // Not (longer) addressed, wait for the next START.
+    i2c0_slave.state = USI0_SLAVE_IDLE;
+    USI0_SDA_DRIVER_DISABLE;
+    USI0_SLAVE_WAIT_FOR_START;
+    I2C0_HW_STATUS_REG = (1 << USIOIF);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_slave_transfer_done.c
+// Description : Poll the interrupt driven USI slave.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_slave_transfer_done.c
+/// \brief  Report transfers finished by the interrupt driven slave.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/// \brief
+/// Report a transfer finished by the interrupt driven slave.
+/// \details
+/// A transfer finishes when the master answers a byte read by 'NACK',
+/// when the slave answers a byte written by 'NACK', or when the master
+/// asserts a (repeated) START or a STOP.
+/// The USI raises no interrupt on STOP, so this is checked here.
+/// Each finished transfer is reported once. If the application misses
+/// one, only the latest is reported.
+/// Dedicated to USI equipped devices.
+/// \param addressReceived gets the address field sent by the master,
+/// the R/W-flag tells the direction.
+/// \param byteCount gets the count of bytes written to the receive
+/// buffer or read from the transmit buffer.
+/// \returns ~0 if a transfer has finished, 0 if not.
+uint8_t usi0_slave_transfer_done(uint8_t *addressReceived, uint8_t *byteCount)
+{
+    uint8_t sreg = SREG;
+    cli();
+    if ((I2C0_HW_STATUS_REG & (1 << USIPF)) && (i2c0_slave.state >= USI0_SLAVE_SEND_DATA))
+    {
+        USI0_SLAVE_TRANSFER_FINISHED;
+        USI0_SDA_DRIVER_DISABLE;
+        USI0_SLAVE_WAIT_FOR_START;
+        I2C0_HW_STATUS_REG = (1 << USIPF);
+    }
+    uint8_t done = i2c0_slave.done;
+    if (done)
+    {
+        *addressReceived = i2c0_slave.doneAddress;
+        *byteCount = i2c0_slave.doneCount;
+        i2c0_slave.done = 0;
+    }
+    SREG = sreg;
+    return(done);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_SLAVE) && !defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_INTERRUPT_DRIVEN) */
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_timer0_master_isr.c
+// Description : Interrupts of the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_timer0_master_isr.c
+/// \brief  Interrupt service routines of the Timer0 clocked bus master.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+
+/// \brief
+/// Timer0 compare interrupt, toggles SCL every half bit time.
+/// \details
+/// The toggle is skipped while the counter overflow still waits for its
+/// interrupt or while a slave stretches SCL. Then the toggle is retried
+/// half a bit time later.
+/// Dedicated to USI equipped devices.
+ISR(I2C0_HW_TIMER_COMPARE_vect)
+{
+    // Byte or bit done, the overflow interrupt sets up the next phase.
+    if (I2C0_HW_STATUS_REG & (1 << USIOIF))
+        return;
+    // SCL released but still low: slave stretches the clock.
+    if ((I2C0_HW_PORT & (1 << I2C0_HW_SCL_BIT)) && I2C0_SCL_IS_LOW)
+        return;
+    I2C0_HW_CONTROL_REG = USI0_TIMER0_MASTER_MODE | (1 << USITC);
+}
+
+
+/// \brief
+/// USI counter overflow interrupt, completes a data byte or an ACK bit.
+/// \details
+/// SCL is held low by the USI until the overflow flag gets cleared, so
+/// the next phase is set up without any hurry.
+/// Dedicated to USI equipped devices.
+ISR(I2C0_HW_OVERFLOW_vect)
+{
+    switch (i2c0_bit_engine_state)
+    {
+        case USI0_TIMER0_TX_DATA:
+            // Release SDA for the slave to ACK.
+            USI0_SDA_DRIVER_DISABLE;
+            i2c0_bit_engine_state = USI0_TIMER0_TX_ACK;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+            return;
+        case USI0_TIMER0_TX_ACK:
+            if (I2C0_HW_DATA_REG & 0x01)
+                i2c0_failure_info |= I2C_NO_ACK;
+            break;
+        case USI0_TIMER0_RX_DATA_ACK:
+        case USI0_TIMER0_RX_DATA_NACK:
+            i2c0_received_byte = I2C0_HW_DATA_REG;
+            // Prepare ACK or NACK reply and send it.
+            if (i2c0_bit_engine_state == USI0_TIMER0_RX_DATA_ACK)
+                I2C0_HW_DATA_REG = 0x00;
+            else
+                I2C0_HW_DATA_REG = 0xFF;
+            USI0_SDA_DRIVER_ENABLE;
+            i2c0_bit_engine_state = USI0_TIMER0_RX_ACK;
+            I2C0_HW_STATUS_REG = (1 << USIOIF) | USI_COUNT_FOR_A_BIT_SLAVE;
+            return;
+        case USI0_TIMER0_RX_ACK:
+            USI0_SDA_DRIVER_DISABLE;
+            break;
+        default:
+            i2c0_failure_info |= I2C_PROTOCOL_FAIL;
+    }
+    // Done, SCL stays low until the next byte.
+    USI0_TIMER0_STOP;
+    i2c0_bit_engine_state = USI0_TIMER0_IDLE;
+    I2C0_HW_STATUS_REG = (1 << USIOIF);
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_wait_until_bit_done_calibrated.c
+// Description : Wait until transfer of one bit is done, runtime bus speed.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_wait_until_bit_done_calibrated.c
+/// \brief  Clocks one bit at the bus speed set by `usi0_set_speed()`.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_RUNTIME_SPEED) && !defined(I2C0_HW_INLINE_PRIMITIVES) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+
+/// \brief
+/// Control of bit to send or receive, runtime bus speed.
+/// \details
+/// Same as `usi0_wait_until_bit_done_as_multimaster()`, the SCL phases
+/// are timed by the delay loops calibrated by `usi0_set_speed()`. The
+/// byte loops call it while the bus runs slower than `F_I2C0_HW`.
+void usi0_wait_until_bit_done_calibrated(void)
+{
+    usi0_wait_until_bit_done_calibrated_inline();
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_RUNTIME_SPEED) && !defined(I2C0_HW_INLINE_PRIMITIVES) */
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_wait_until_done_timer0_master.c
+// Description : Wait for the Timer0 clocked USI master.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_wait_until_done_timer0_master.c
+/// \brief  Synchronize to the byte in progress.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+#include <avr/io.h>
+
+/// \brief
+/// Wait until the Timer0 clocked master has finished the byte in progress.
+/// \details
+/// Returns immediately if there is no transfer in progress.
+/// Dedicated to USI equipped devices.
+void usi0_wait_until_done_timer0_master(void)
+{
+    while (i2c0_bit_engine_state != USI0_TIMER0_IDLE) {}
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && !defined(I2C0_HW_AS_SLAVE) && defined(I2C0_HW_AS_MASTER) && defined(I2C0_HW_SINGLE_MASTER) && defined(I2C0_HW_TIMER0_CLOCKED) */
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : usi0_write_block.c
+// Description : Write a block of bytes to an addressed slave - USI.
+// Author      :
+// Project     : I²C-Lib
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+//  --- Doxygen ---
+/// \file   usi0_write_block.c
+/// \brief  Submit a block of bytes in any master mode.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "i2c_hw.h"
+#if defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) || defined DOXYGEN_DOCU_IS_GENERATED
+#include "i2c_lib_private.h"
+
+#if !defined I2C0_HW_TIMER0_CLOCKED
+// The byte loop of the block, `calibrated` a constant. The byte bodies
+// get inlined, the bus timing is chosen once per block instead of once
+// per byte.
+USI0_INLINE void usi0_write_block_timed(const uint8_t *buffer, uint16_t length, uint8_t calibrated)
+{
+    while (length--)
+    {
+#   if defined I2C0_HW_SINGLE_MASTER
+        usi0_send_byte_single_master_timed_inline(*buffer++, calibrated);
+#   else
+        usi0_send_byte_multi_master_timed_inline(*buffer++, calibrated);
+#   endif
+        if (i2c0_failure_info)
+            break;
+    }
+}
+#endif
+
+
+/// \brief
+/// Submit a block of bytes as a bus master.
+/// \details
+/// Access the already adressed slave to write `length` bytes.
+/// The transfer ends early at the first byte not acknowledged or any
+/// other failure.
+/// The masters clocked by software run the byte bodies inline, the
+/// Timer0 clocked master sends byte by byte and waits for the last byte
+/// to finish, its status is reported as well.
+/// Dedicated to USI equipped devices.
+/// \param buffer holds the bytes to send.
+/// \param length number of bytes to send.
+/// \returns failure code according to `I2C_FAILURE_type`.
+/// See `i2c_def.h`
+enum I2C_FAILURE_type usi0_write_block(const uint8_t *buffer, uint16_t length)
+{
+#if defined I2C0_HW_TIMER0_CLOCKED
+    while (length--)
+    {
+        hardI2c0_putByteAsMaster(*buffer++);
+        if (i2c0_failure_info)
+            break;
+    }
+#else
+    if (USI0_PHASES_CALIBRATED)
+        usi0_write_block_timed(buffer, length, 1);
+    else
+        usi0_write_block_timed(buffer, length, 0);
+#endif
+    return(hardI2c0_check4Error());
+}
+
+
+#endif /* defined(I2C_HW_USI_H_INCLUDED) && defined(I2C0_HW_AS_MASTER) */
@@ -75,7 +75,7 @@ uint8_t toggle = 0;
 /// \returns Failure code(s) occured during last bus access(es).
 uint8_t get_byte_from_pcf8574 (uint8_t* byte_p)
 {
-    if (!hardI2c0_openDevice(PCF8574_ADDRESS | I2C_READ_ACCESS))
+    if (!hardI2c0_openDeviceRetry(PCF8574_ADDRESS | I2C_READ_ACCESS, 0))
     {
         *byte_p = hardI2c0_getByteAsMaster(I2C_SEND_NO_ACK);
     }
@@ -99,7 +99,7 @@ uint8_t get_byte_from_pcf8574 (uint8_t* byte_p)
 /// \returns Failure code(s) occured during last bus access(es).
 uint8_t put_byte_to_pcf8574 (uint8_t byte)
 {
-    if (!hardI2c0_openDevice(PCF8574_ADDRESS | I2C_WRITE_ACCESS))
+    if (!hardI2c0_openDeviceRetry(PCF8574_ADDRESS | I2C_WRITE_ACCESS, 0))
     {
         hardI2c0_putByteAsMaster(byte);
     }
@@ -153,10 +153,8 @@ int main (void)
                     hardI2c0_releaseBus();
                     break;
                 }
-                while(hardI2c0_check4Error() & (I2C_ARBITRATION_LOST | I2C_RESTARTED))
-                {
-//                  do_other_activities();
-                }
+                // A lost arbitration has been retried with backoff already,
+                // just start over.
             } // PCF8574 is done
             // simple bus error indication
             if (hardI2c0_check4Error())
@@ -128,7 +128,7 @@ void do_the_slave_activities (void)
 /// \returns Failure code(s) occured during last bus access(es).
 uint8_t get_byte_from_pcf8574 (uint8_t* byte_p)
 {
-    if (!hardI2c0_openDevice(PCF8574_ADDRESS | I2C_READ_ACCESS))
+    if (!hardI2c0_openDeviceRetry(PCF8574_ADDRESS | I2C_READ_ACCESS, do_the_slave_activities))
     {
         *byte_p = hardI2c0_getByteAsMaster(I2C_SEND_NO_ACK);
     }
@@ -152,7 +152,7 @@ uint8_t get_byte_from_pcf8574 (uint8_t* byte_p)
 /// \returns Failure code(s) occured during last bus access(es).
 uint8_t put_byte_to_pcf8574 (uint8_t byte)
 {
-    if (!hardI2c0_openDevice(PCF8574_ADDRESS | I2C_WRITE_ACCESS))
+    if (!hardI2c0_openDeviceRetry(PCF8574_ADDRESS | I2C_WRITE_ACCESS, do_the_slave_activities))
     {
         hardI2c0_putByteAsMaster(byte);
     }
@@ -176,7 +176,7 @@ uint8_t put_byte_to_pcf8574 (uint8_t byte)
 /// \returns Failure code(s) occured during last bus access(es).
 uint8_t put_byte_to_remote_slave (uint8_t byte)
 {
-    if (!hardI2c0_openDevice(REMOTE_SLAVE | I2C_WRITE_ACCESS))
+    if (!hardI2c0_openDeviceRetry(REMOTE_SLAVE | I2C_WRITE_ACCESS, do_the_slave_activities))
     {
         hardI2c0_putByteAsMaster(byte);
     }
@@ -238,10 +238,10 @@ int main (void)
                 { // no such slave device - skip or die looping ...
                     break;
                 }
-                while(hardI2c0_check4Error() & (I2C_ARBITRATION_LOST | I2C_RESTARTED))
-                {
+                // Backed off and retried already, serve the winner if it
+                // addresses this device before the next round.
+                if (hardI2c0_check4Error() & (I2C_ARBITRATION_LOST | I2C_RESTARTED))
                     do_the_slave_activities();
-                }
             } // PCF8574 is done, now the remote slave - bus still is occupied
             // simple bus error indication
             if (hardI2c0_check4Error())
@@ -258,10 +258,10 @@ int main (void)
                 { // success or no such device (prevents looping until dooms day)
                     break;
                 }
-                while(hardI2c0_check4Error() & (I2C_ARBITRATION_LOST | I2C_RESTARTED))
-                {
+                // Backed off and retried already, serve the winner if it
+                // addresses this device before the next round.
+                if (hardI2c0_check4Error() & (I2C_ARBITRATION_LOST | I2C_RESTARTED))
                     do_the_slave_activities();
-                }
             } // The remote slave is also done now, the bus has been released.
             // simple bus error indication
             if (hardI2c0_check4Error())
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// File        : i2c_sm_usi_isr.c
+// Description : Interrupt driven slave mode application demo.
+// Author      :
+// Project     : I²C-Lib Demo
+// Initial date: Oct / 17 / 2026
+// Copyright   :
+// License     : GNU General Public License V3 (GPLv3)
+//               See project root LICENSE file or
+//               https://www.gnu.org/licenses/gpl-3.0.html
+////////////////////////////////////////////////////////////////////////////////
+
+
+/// \file i2c_sm_usi_isr.c
+/// \brief
+/// Demo application performing as bus slave, served by the interrupts of
+/// the lib. Same job as `i2c_sm_usi.c`, which polls the bus instead.
+
+
+// Check project settings (Makefile) to match this demo:
+#ifdef I2C0_HW_AS_MASTER
+#error "I2C0_HW_AS_MASTER is set but invalid here!"
+#endif
+#ifndef I2C0_HW_AS_SLAVE
+#error "I2C0_HW_AS_SLAVE is *not* set but needed here!"
+#endif
+#ifdef I2C0_HW_SINGLE_MASTER
+#error "I2C0_HW_SINGLE_MASTER is set but invalid here!"
+#endif
+#ifndef I2C0_HW_INTERRUPT_DRIVEN
+#error "I2C0_HW_INTERRUPT_DRIVEN is *not* set but needed here!"
+#endif
+
+
+// necessary includes
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "i2c_hw.h"
+
+
+// definitions for hardware
+#define OWN_SLAVE_ADDRESS  (0b0100010 << 1)
+
+#define LED_PORT           PORTB
+#define LED_DDR            DDRB
+#define LED_BIT            1
+#define LED_BITMASK        (1<<LED_BIT)
+
+
+// definitions to support coding
+#define INIT_LEDS          LED_DDR  |= LED_BITMASK
+#define TURN_ALL_LEDS_OFF  LED_PORT &= ~LED_BITMASK
+#define TURN_LED_ON        LED_PORT |= LED_BITMASK
+#define TURN_LED_OFF       LED_PORT &= ~LED_BITMASK
+
+
+// declare (and init) some variables
+uint8_t slave_read_access_counter = 0;
+uint8_t slave_rx_buffer[1];
+uint8_t slave_tx_buffer[1];
+
+
+/******************************************************************************\
+
+  Slave and master activities on IӃ bus.
+
+\******************************************************************************/
+
+
+/// \brief
+/// Implements the slave actions.
+/// \details
+/// Reading via IӃ just sends a count value. Unlike the polled demo
+/// it counts read transfers, not bytes: the slave buffer holds one byte.
+/// Writing via IӃ decides if a LED is turned on or off. If byte is 0x00
+/// then LED gets off, else on.
+/// The bytes are moved by the interrupts of the lib, here only finished
+/// transfers are handled.
+void do_the_slave_activities (void)
+{
+    uint8_t addressReceived;
+    uint8_t byteCount;
+    if (hardI2c0_slaveTransferDone(&addressReceived, &byteCount) && byteCount)
+    {
+        if ((addressReceived & 0x01) == I2C_READ_ACCESS)
+        {
+            // Counter has been read, prepare the next value.
+            slave_tx_buffer[0] = ++slave_read_access_counter;
+        }
+        else
+        {
+            if (slave_rx_buffer[0])
+                TURN_LED_ON;
+            else
+                TURN_LED_OFF;
+        }
+    }
+}
+
+
+/******************************************************************************\
+
+ main loop
+
+\******************************************************************************/
+
+
+int main (void)
+{
+   // init IO ports
+   TURN_ALL_LEDS_OFF;
+   INIT_LEDS;
+   // init I²C subsystem
+   hardI2c0_init(OWN_SLAVE_ADDRESS,
+                 0,                       // exact address match
+                 I2C0_BITRATE,            // predefined by the lib
+                 I2C0_PRESCALER);         // predefined by the lib
+
+   slave_tx_buffer[0] = slave_read_access_counter;
+   hardI2c0_setSlaveBuffers(slave_rx_buffer, sizeof(slave_rx_buffer),
+                            slave_tx_buffer, sizeof(slave_tx_buffer));
+   sei();
+
+   // repeat until dooms day
+   while (1)
+   {
+      do_the_slave_activities();
+      // The bus is served by the interrupts, other tasks go here.
+   } // while (1)
+}